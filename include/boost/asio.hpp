@@ -75,6 +75,7 @@
 #include <boost/asio/connect_pipe.hpp>
 #include <boost/asio/consign.hpp>
 #include <boost/asio/coroutine.hpp>
+#include <boost/asio/datagram_slot.hpp>
 #include <boost/asio/defer.hpp>
 #include <boost/asio/deferred.hpp>
 #include <boost/asio/default_completion_token.hpp>
@@ -110,6 +111,7 @@
 #include <boost/asio/inline_executor.hpp>
 #include <boost/asio/inline_or_executor.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/io_context_group.hpp>
 #include <boost/asio/io_context_strand.hpp>
 #include <boost/asio/ip/address.hpp>
 #include <boost/asio/ip/address_v4.hpp>
@@ -156,6 +158,7 @@
 #include <boost/asio/post.hpp>
 #include <boost/asio/prefer.hpp>
 #include <boost/asio/prepend.hpp>
+#include <boost/asio/provided_buffer_ring.hpp>
 #include <boost/asio/query.hpp>
 #include <boost/asio/random_access_file.hpp>
 #include <boost/asio/read.hpp>
@@ -170,12 +173,14 @@
 #include <boost/asio/require_concept.hpp>
 #include <boost/asio/serial_port.hpp>
 #include <boost/asio/serial_port_base.hpp>
+#include <boost/asio/sharded_acceptor.hpp>
 #include <boost/asio/signal_set.hpp>
 #include <boost/asio/signal_set_base.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/asio/static_thread_pool.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/strand.hpp>
+#include <boost/asio/strand_statistics.hpp>
 #include <boost/asio/stream_file.hpp>
 #include <boost/asio/streambuf.hpp>
 #include <boost/asio/system_context.hpp>
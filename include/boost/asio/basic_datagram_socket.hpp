@@ -18,11 +18,13 @@
 #include <boost/asio/detail/config.hpp>
 #include <cstddef>
 #include <boost/asio/basic_socket.hpp>
+#include <boost/asio/datagram_slot.hpp>
 #include <boost/asio/detail/handler_type_requirements.hpp>
 #include <boost/asio/detail/non_const_lvalue.hpp>
 #include <boost/asio/detail/throw_error.hpp>
 #include <boost/asio/detail/type_traits.hpp>
 #include <boost/asio/error.hpp>
+#include <boost/asio/provided_buffer_ring.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
 
@@ -61,8 +63,13 @@ class basic_datagram_socket
 private:
   class initiate_async_send;
   class initiate_async_send_to;
+  class initiate_async_send_to_many;
+  class initiate_async_send_to_segmented;
   class initiate_async_receive;
+  class initiate_async_receive_provided;
   class initiate_async_receive_from;
+  class initiate_async_receive_from_many;
+  class initiate_async_receive_from_coalesced;
 
 public:
   /// The type of the executor associated with the object.
@@ -773,6 +780,298 @@ public:
         buffers, destination, flags);
   }
 
+  /// Start an asynchronous send of a batch of datagrams.
+  /**
+   * This function is used to asynchronously send a batch of datagrams, each to
+   * its own remote endpoint. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
+   *
+   * Where supported by the operating system, the datagrams are sent using a
+   * single system call. The operation completes once at least one datagram
+   * has been sent, and may send fewer datagrams than were supplied.
+   *
+   * @param slots An array of slots, each holding a datagram to be sent and
+   * its destination. On completion, the bytes_transferred() of each slot that
+   * was sent is updated. Ownership of the slots and of the underlying memory
+   * blocks is retained by the caller, which must guarantee that they remain
+   * valid until the completion handler is called.
+   *
+   * @param count The number of slots in the array.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes. Potential
+   * completion tokens include @ref use_future, @ref use_awaitable, @ref
+   * yield_context, or a function object with the correct completion signature.
+   * The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t datagrams_transferred // Number of datagrams sent, which
+   *                                     // are the leading slots.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   *
+   * @par Example
+   * To send two datagrams in a single operation:
+   * @code
+   * boost::asio::datagram_slot<boost::asio::const_buffer,
+   *     boost::asio::ip::udp::endpoint> slots[2] =
+   * {
+   *   { boost::asio::buffer(data1, size1), destination1 },
+   *   { boost::asio::buffer(data2, size2), destination2 }
+   * };
+   * socket.async_send_to_many(slots, 2, handler);
+   * @endcode
+   */
+  template <
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_send_to_many(
+      datagram_slot<const_buffer, endpoint_type>* slots, std::size_t count,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (boost::system::error_code, std::size_t)>(
+          declval<initiate_async_send_to_many>(), token, slots, count,
+          socket_base::message_flags(0)))
+  {
+    return async_initiate<WriteToken,
+      void (boost::system::error_code, std::size_t)>(
+        initiate_async_send_to_many(this), token, slots, count,
+        socket_base::message_flags(0));
+  }
+
+  /// Start an asynchronous send of a batch of datagrams.
+  /**
+   * This function is used to asynchronously send a batch of datagrams, each to
+   * its own remote endpoint. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
+   *
+   * Where supported by the operating system, the datagrams are sent using a
+   * single system call. The operation completes once at least one datagram
+   * has been sent, and may send fewer datagrams than were supplied.
+   *
+   * @param slots An array of slots, each holding a datagram to be sent and
+   * its destination. On completion, the bytes_transferred() of each slot that
+   * was sent is updated. Ownership of the slots and of the underlying memory
+   * blocks is retained by the caller, which must guarantee that they remain
+   * valid until the completion handler is called.
+   *
+   * @param count The number of slots in the array.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes. Potential
+   * completion tokens include @ref use_future, @ref use_awaitable, @ref
+   * yield_context, or a function object with the correct completion signature.
+   * The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t datagrams_transferred // Number of datagrams sent, which
+   *                                     // are the leading slots.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_send_to_many(
+      datagram_slot<const_buffer, endpoint_type>* slots, std::size_t count,
+      socket_base::message_flags flags,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (boost::system::error_code, std::size_t)>(
+          declval<initiate_async_send_to_many>(), token,
+          slots, count, flags))
+  {
+    return async_initiate<WriteToken,
+      void (boost::system::error_code, std::size_t)>(
+        initiate_async_send_to_many(this), token, slots, count, flags);
+  }
+
+  /// Start an asynchronous send of data split into equally sized datagrams.
+  /**
+   * This function is used to asynchronously send a run of datagrams to the
+   * specified remote endpoint, using a single system call. The data is split
+   * by the kernel, or by the network interface, into datagrams of @c
+   * segment_size bytes each, with the last datagram holding any remainder. It
+   * is an initiating function for an @ref asynchronous_operation, and always
+   * returns immediately.
+   *
+   * @param buffers One or more data buffers holding the datagrams to be sent.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param destination The remote endpoint to which the data will be sent.
+   * Copies will be made of the endpoint as required.
+   *
+   * @param segment_size The size of each datagram. A value of zero sends the
+   * data as a single datagram.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes. Potential
+   * completion tokens include @ref use_future, @ref use_awaitable, @ref
+   * yield_context, or a function object with the correct completion signature.
+   * The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t) @endcode
+   *
+   * @note The operation fails with boost::asio::error::operation_not_supported
+   * if a non-zero segment size is given and the operating system does not
+   * support segmentation offload. The boost::asio::ip::udp::segment_size
+   * socket option may instead be used to apply a segment size to every send.
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   *
+   * @par Example
+   * To send three 1200-byte datagrams in a single operation:
+   * @code
+   * socket.async_send_to_segmented(
+   *     boost::asio::buffer(data, 3600), destination, 1200, handler);
+   * @endcode
+   */
+  template <typename ConstBufferSequence,
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_send_to_segmented(const ConstBufferSequence& buffers,
+      const endpoint_type& destination, std::size_t segment_size,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (boost::system::error_code, std::size_t)>(
+          declval<initiate_async_send_to_segmented>(), token, buffers,
+          destination, segment_size, socket_base::message_flags(0)))
+  {
+    return async_initiate<WriteToken,
+      void (boost::system::error_code, std::size_t)>(
+        initiate_async_send_to_segmented(this), token, buffers,
+        destination, segment_size, socket_base::message_flags(0));
+  }
+
+  /// Start an asynchronous send of data split into equally sized datagrams.
+  /**
+   * This function is used to asynchronously send a run of datagrams to the
+   * specified remote endpoint, using a single system call. The data is split
+   * by the kernel, or by the network interface, into datagrams of @c
+   * segment_size bytes each, with the last datagram holding any remainder. It
+   * is an initiating function for an @ref asynchronous_operation, and always
+   * returns immediately.
+   *
+   * @param buffers One or more data buffers holding the datagrams to be sent.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param destination The remote endpoint to which the data will be sent.
+   * Copies will be made of the endpoint as required.
+   *
+   * @param segment_size The size of each datagram. A value of zero sends the
+   * data as a single datagram.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes. Potential
+   * completion tokens include @ref use_future, @ref use_awaitable, @ref
+   * yield_context, or a function object with the correct completion signature.
+   * The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t) @endcode
+   *
+   * @note The operation fails with boost::asio::error::operation_not_supported
+   * if a non-zero segment size is given and the operating system does not
+   * support segmentation offload. The boost::asio::ip::udp::segment_size
+   * socket option may instead be used to apply a segment size to every send.
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename ConstBufferSequence,
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_send_to_segmented(const ConstBufferSequence& buffers,
+      const endpoint_type& destination, std::size_t segment_size,
+      socket_base::message_flags flags,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (boost::system::error_code, std::size_t)>(
+          declval<initiate_async_send_to_segmented>(), token,
+          buffers, destination, segment_size, flags))
+  {
+    return async_initiate<WriteToken,
+      void (boost::system::error_code, std::size_t)>(
+        initiate_async_send_to_segmented(this), token,
+        buffers, destination, segment_size, flags);
+  }
+
   /// Receive some data on a connected socket.
   /**
    * This function is used to receive data on the datagram socket. The function
@@ -991,6 +1290,131 @@ public:
         initiate_async_receive(this), token, buffers, flags);
   }
 
+  /// Start an asynchronous receive into a buffer selected from a ring.
+  /**
+   * This function is used to asynchronously receive a datagram into a buffer
+   * that is selected from a provided_buffer_ring only once the datagram has
+   * arrived. It is an initiating function for an @ref asynchronous_operation,
+   * and always returns immediately.
+   *
+   * @param ring The ring from which a buffer will be selected. Ownership of
+   * the ring is retained by the caller, which must guarantee that it remains
+   * valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   boost::asio::provided_buffer buffer // The received datagram.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, boost::asio::provided_buffer)
+   * @endcode
+   *
+   * @note On success, the application must return the buffer to the ring by
+   * calling provided_buffer_ring::recycle() once it has finished with the
+   * data. A datagram larger than the ring's buffer size is truncated. The
+   * endpoint of the sender is not reported. If the ring has no free buffers
+   * the operation fails with boost::asio::error::no_buffer_space.
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        provided_buffer)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive(provided_buffer_ring& ring,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, provided_buffer)>(
+          declval<initiate_async_receive_provided>(), token,
+          &ring, socket_base::message_flags(0)))
+  {
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, provided_buffer)>(
+        initiate_async_receive_provided(this), token,
+        &ring, socket_base::message_flags(0));
+  }
+
+  /// Start an asynchronous receive into a buffer selected from a ring.
+  /**
+   * This function is used to asynchronously receive a datagram into a buffer
+   * that is selected from a provided_buffer_ring only once the datagram has
+   * arrived. It is an initiating function for an @ref asynchronous_operation,
+   * and always returns immediately.
+   *
+   * @param ring The ring from which a buffer will be selected. Ownership of
+   * the ring is retained by the caller, which must guarantee that it remains
+   * valid until the completion handler is called.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   boost::asio::provided_buffer buffer // The received datagram.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, boost::asio::provided_buffer)
+   * @endcode
+   *
+   * @note On success, the application must return the buffer to the ring by
+   * calling provided_buffer_ring::recycle() once it has finished with the
+   * data. A datagram larger than the ring's buffer size is truncated. The
+   * endpoint of the sender is not reported. If the ring has no free buffers
+   * the operation fails with boost::asio::error::no_buffer_space.
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        provided_buffer)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive(provided_buffer_ring& ring,
+      socket_base::message_flags flags,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, provided_buffer)>(
+          declval<initiate_async_receive_provided>(), token, &ring, flags))
+  {
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, provided_buffer)>(
+        initiate_async_receive_provided(this), token, &ring, flags);
+  }
+
   /// Receive a datagram with the endpoint of the sender.
   /**
    * This function is used to receive a datagram. The function call will block
@@ -1038,53 +1462,322 @@ public:
    * @param sender_endpoint An endpoint object that receives the endpoint of
    * the remote sender of the datagram.
    *
-   * @param flags Flags specifying how the receive call is to be made.
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @returns The number of bytes received.
+   *
+   * @throws boost::system::system_error Thrown on failure.
+   */
+  template <typename MutableBufferSequence>
+  std::size_t receive_from(const MutableBufferSequence& buffers,
+      endpoint_type& sender_endpoint, socket_base::message_flags flags)
+  {
+    boost::system::error_code ec;
+    std::size_t s = this->impl_.get_service().receive_from(
+        this->impl_.get_implementation(), buffers, sender_endpoint, flags, ec);
+    boost::asio::detail::throw_error(ec, "receive_from");
+    return s;
+  }
+
+  /// Receive a datagram with the endpoint of the sender.
+  /**
+   * This function is used to receive a datagram. The function call will block
+   * until data has been received successfully or an error occurs.
+   *
+   * @param buffers One or more buffers into which the data will be received.
+   *
+   * @param sender_endpoint An endpoint object that receives the endpoint of
+   * the remote sender of the datagram.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns The number of bytes received.
+   */
+  template <typename MutableBufferSequence>
+  std::size_t receive_from(const MutableBufferSequence& buffers,
+      endpoint_type& sender_endpoint, socket_base::message_flags flags,
+      boost::system::error_code& ec)
+  {
+    return this->impl_.get_service().receive_from(
+        this->impl_.get_implementation(), buffers, sender_endpoint, flags, ec);
+  }
+
+  /// Start an asynchronous receive.
+  /**
+   * This function is used to asynchronously receive a datagram. It is an
+   * initiating function for an @ref asynchronous_operation, and always returns
+   * immediately.
+   *
+   * @param buffers One or more buffers into which the data will be received.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param sender_endpoint An endpoint object that receives the endpoint of
+   * the remote sender of the datagram. Ownership of the sender_endpoint object
+   * is retained by the caller, which must guarantee that it is valid until the
+   * completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t) @endcode
+   *
+   * @par Example
+   * To receive into a single data buffer use the @ref buffer function as
+   * follows:
+   * @code socket.async_receive_from(
+   *     boost::asio::buffer(data, size), sender_endpoint, handler); @endcode
+   * See the @ref buffer documentation for information on receiving into
+   * multiple buffers in one go, and how to use it with arrays, boost::array or
+   * std::vector.
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX or Windows operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename MutableBufferSequence,
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive_from(const MutableBufferSequence& buffers,
+      endpoint_type& sender_endpoint,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, std::size_t)>(
+          declval<initiate_async_receive_from>(), token, buffers,
+          &sender_endpoint, socket_base::message_flags(0)))
+  {
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, std::size_t)>(
+        initiate_async_receive_from(this), token, buffers,
+        &sender_endpoint, socket_base::message_flags(0));
+  }
+
+  /// Start an asynchronous receive.
+  /**
+   * This function is used to asynchronously receive a datagram. It is an
+   * initiating function for an @ref asynchronous_operation, and always returns
+   * immediately.
+   *
+   * @param buffers One or more buffers into which the data will be received.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param sender_endpoint An endpoint object that receives the endpoint of
+   * the remote sender of the datagram. Ownership of the sender_endpoint object
+   * is retained by the caller, which must guarantee that it is valid until the
+   * completion handler is called.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX or Windows operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename MutableBufferSequence,
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive_from(const MutableBufferSequence& buffers,
+      endpoint_type& sender_endpoint, socket_base::message_flags flags,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, std::size_t)>(
+          declval<initiate_async_receive_from>(), token,
+          buffers, &sender_endpoint, flags))
+  {
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, std::size_t)>(
+        initiate_async_receive_from(this), token,
+        buffers, &sender_endpoint, flags);
+  }
+
+  /// Start an asynchronous receive of a batch of datagrams.
+  /**
+   * This function is used to asynchronously receive a batch of datagrams. It
+   * is an initiating function for an @ref asynchronous_operation, and always
+   * returns immediately.
+   *
+   * Where supported by the operating system, the datagrams are received using
+   * a single system call. The operation completes once at least one datagram
+   * has been received, and receives as many of the datagrams already queued
+   * on the socket as will fit in the supplied slots.
+   *
+   * @param slots An array of slots, each holding a buffer into which a
+   * datagram will be received. On completion, the endpoint() and
+   * bytes_transferred() of each slot that received a datagram are updated.
+   * Ownership of the slots and of the underlying memory blocks is retained by
+   * the caller, which must guarantee that they remain valid until the
+   * completion handler is called.
+   *
+   * @param count The number of slots in the array.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t datagrams_transferred // Number of datagrams received,
+   *                                     // which fill the leading slots.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
    *
-   * @returns The number of bytes received.
+   * @li @c cancellation_type::partial
    *
-   * @throws boost::system::system_error Thrown on failure.
+   * @li @c cancellation_type::total
    */
-  template <typename MutableBufferSequence>
-  std::size_t receive_from(const MutableBufferSequence& buffers,
-      endpoint_type& sender_endpoint, socket_base::message_flags flags)
+  template <
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive_from_many(
+      datagram_slot<mutable_buffer, endpoint_type>* slots, std::size_t count,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, std::size_t)>(
+          declval<initiate_async_receive_from_many>(), token, slots, count,
+          socket_base::message_flags(0)))
   {
-    boost::system::error_code ec;
-    std::size_t s = this->impl_.get_service().receive_from(
-        this->impl_.get_implementation(), buffers, sender_endpoint, flags, ec);
-    boost::asio::detail::throw_error(ec, "receive_from");
-    return s;
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, std::size_t)>(
+        initiate_async_receive_from_many(this), token, slots, count,
+        socket_base::message_flags(0));
   }
 
-  /// Receive a datagram with the endpoint of the sender.
+  /// Start an asynchronous receive of a batch of datagrams.
   /**
-   * This function is used to receive a datagram. The function call will block
-   * until data has been received successfully or an error occurs.
+   * This function is used to asynchronously receive a batch of datagrams. It
+   * is an initiating function for an @ref asynchronous_operation, and always
+   * returns immediately.
    *
-   * @param buffers One or more buffers into which the data will be received.
+   * Where supported by the operating system, the datagrams are received using
+   * a single system call. The operation completes once at least one datagram
+   * has been received, and receives as many of the datagrams already queued
+   * on the socket as will fit in the supplied slots.
    *
-   * @param sender_endpoint An endpoint object that receives the endpoint of
-   * the remote sender of the datagram.
+   * @param slots An array of slots, each holding a buffer into which a
+   * datagram will be received. On completion, the endpoint() and
+   * bytes_transferred() of each slot that received a datagram are updated.
+   * Ownership of the slots and of the underlying memory blocks is retained by
+   * the caller, which must guarantee that they remain valid until the
+   * completion handler is called.
+   *
+   * @param count The number of slots in the array.
    *
    * @param flags Flags specifying how the receive call is to be made.
    *
-   * @param ec Set to indicate what error occurred, if any.
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t datagrams_transferred // Number of datagrams received,
+   *                                     // which fill the leading slots.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
    *
-   * @returns The number of bytes received.
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
    */
-  template <typename MutableBufferSequence>
-  std::size_t receive_from(const MutableBufferSequence& buffers,
-      endpoint_type& sender_endpoint, socket_base::message_flags flags,
-      boost::system::error_code& ec)
+  template <
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive_from_many(
+      datagram_slot<mutable_buffer, endpoint_type>* slots, std::size_t count,
+      socket_base::message_flags flags,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, std::size_t)>(
+          declval<initiate_async_receive_from_many>(), token,
+          slots, count, flags))
   {
-    return this->impl_.get_service().receive_from(
-        this->impl_.get_implementation(), buffers, sender_endpoint, flags, ec);
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, std::size_t)>(
+        initiate_async_receive_from_many(this), token, slots, count, flags);
   }
 
-  /// Start an asynchronous receive.
+  /// Start an asynchronous receive of datagrams coalesced by the kernel.
   /**
-   * This function is used to asynchronously receive a datagram. It is an
-   * initiating function for an @ref asynchronous_operation, and always returns
-   * immediately.
+   * This function is used to asynchronously receive data that the kernel may
+   * have coalesced from several datagrams sent by the same remote endpoint.
+   * Coalescing is only performed when the boost::asio::ip::udp::receive_offload
+   * socket option is enabled. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
    *
    * @param buffers One or more buffers into which the data will be received.
    * Although the buffers object may be copied as necessary, ownership of the
@@ -1092,10 +1785,16 @@ public:
    * that they remain valid until the completion handler is called.
    *
    * @param sender_endpoint An endpoint object that receives the endpoint of
-   * the remote sender of the datagram. Ownership of the sender_endpoint object
+   * the remote sender of the data. Ownership of the sender_endpoint object
    * is retained by the caller, which must guarantee that it is valid until the
    * completion handler is called.
    *
+   * @param segment_size On completion, set to the size of each coalesced
+   * datagram. Only the last datagram may be shorter. When no coalescing took
+   * place, this is the number of bytes received. Ownership of the object is
+   * retained by the caller, which must guarantee that it is valid until the
+   * completion handler is called.
+   *
    * @param token The @ref completion_token that will be used to produce a
    * completion handler, which will be called when the receive completes.
    * Potential completion tokens include @ref use_future, @ref use_awaitable,
@@ -1113,17 +1812,8 @@ public:
    * @par Completion Signature
    * @code void(boost::system::error_code, std::size_t) @endcode
    *
-   * @par Example
-   * To receive into a single data buffer use the @ref buffer function as
-   * follows:
-   * @code socket.async_receive_from(
-   *     boost::asio::buffer(data, size), sender_endpoint, handler); @endcode
-   * See the @ref buffer documentation for information on receiving into
-   * multiple buffers in one go, and how to use it with arrays, boost::array or
-   * std::vector.
-   *
    * @par Per-Operation Cancellation
-   * On POSIX or Windows operating systems, this asynchronous operation supports
+   * On POSIX operating systems, this asynchronous operation supports
    * cancellation for the following boost::asio::cancellation_type values:
    *
    * @li @c cancellation_type::terminal
@@ -1131,30 +1821,42 @@ public:
    * @li @c cancellation_type::partial
    *
    * @li @c cancellation_type::total
+   *
+   * @par Example
+   * To receive into a single data buffer use the @ref buffer function as
+   * follows:
+   * @code
+   * std::size_t segment_size;
+   * socket.async_receive_from_coalesced(
+   *     boost::asio::buffer(data, size), sender_endpoint,
+   *     segment_size, handler);
+   * @endcode
    */
   template <typename MutableBufferSequence,
       BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
         std::size_t)) ReadToken = default_completion_token_t<executor_type>>
-  auto async_receive_from(const MutableBufferSequence& buffers,
-      endpoint_type& sender_endpoint,
+  auto async_receive_from_coalesced(const MutableBufferSequence& buffers,
+      endpoint_type& sender_endpoint, std::size_t& segment_size,
       ReadToken&& token = default_completion_token_t<executor_type>())
     -> decltype(
       async_initiate<ReadToken,
         void (boost::system::error_code, std::size_t)>(
-          declval<initiate_async_receive_from>(), token, buffers,
-          &sender_endpoint, socket_base::message_flags(0)))
+          declval<initiate_async_receive_from_coalesced>(), token, buffers,
+          &sender_endpoint, &segment_size, socket_base::message_flags(0)))
   {
     return async_initiate<ReadToken,
       void (boost::system::error_code, std::size_t)>(
-        initiate_async_receive_from(this), token, buffers,
-        &sender_endpoint, socket_base::message_flags(0));
+        initiate_async_receive_from_coalesced(this), token, buffers,
+        &sender_endpoint, &segment_size, socket_base::message_flags(0));
   }
 
-  /// Start an asynchronous receive.
+  /// Start an asynchronous receive of datagrams coalesced by the kernel.
   /**
-   * This function is used to asynchronously receive a datagram. It is an
-   * initiating function for an @ref asynchronous_operation, and always returns
-   * immediately.
+   * This function is used to asynchronously receive data that the kernel may
+   * have coalesced from several datagrams sent by the same remote endpoint.
+   * Coalescing is only performed when the boost::asio::ip::udp::receive_offload
+   * socket option is enabled. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
    *
    * @param buffers One or more buffers into which the data will be received.
    * Although the buffers object may be copied as necessary, ownership of the
@@ -1162,10 +1864,16 @@ public:
    * that they remain valid until the completion handler is called.
    *
    * @param sender_endpoint An endpoint object that receives the endpoint of
-   * the remote sender of the datagram. Ownership of the sender_endpoint object
+   * the remote sender of the data. Ownership of the sender_endpoint object
    * is retained by the caller, which must guarantee that it is valid until the
    * completion handler is called.
    *
+   * @param segment_size On completion, set to the size of each coalesced
+   * datagram. Only the last datagram may be shorter. When no coalescing took
+   * place, this is the number of bytes received. Ownership of the object is
+   * retained by the caller, which must guarantee that it is valid until the
+   * completion handler is called.
+   *
    * @param flags Flags specifying how the receive call is to be made.
    *
    * @param token The @ref completion_token that will be used to produce a
@@ -1186,7 +1894,7 @@ public:
    * @code void(boost::system::error_code, std::size_t) @endcode
    *
    * @par Per-Operation Cancellation
-   * On POSIX or Windows operating systems, this asynchronous operation supports
+   * On POSIX operating systems, this asynchronous operation supports
    * cancellation for the following boost::asio::cancellation_type values:
    *
    * @li @c cancellation_type::terminal
@@ -1198,19 +1906,20 @@ public:
   template <typename MutableBufferSequence,
       BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
         std::size_t)) ReadToken = default_completion_token_t<executor_type>>
-  auto async_receive_from(const MutableBufferSequence& buffers,
-      endpoint_type& sender_endpoint, socket_base::message_flags flags,
+  auto async_receive_from_coalesced(const MutableBufferSequence& buffers,
+      endpoint_type& sender_endpoint, std::size_t& segment_size,
+      socket_base::message_flags flags,
       ReadToken&& token = default_completion_token_t<executor_type>())
     -> decltype(
       async_initiate<ReadToken,
         void (boost::system::error_code, std::size_t)>(
-          declval<initiate_async_receive_from>(), token,
-          buffers, &sender_endpoint, flags))
+          declval<initiate_async_receive_from_coalesced>(), token,
+          buffers, &sender_endpoint, &segment_size, flags))
   {
     return async_initiate<ReadToken,
       void (boost::system::error_code, std::size_t)>(
-        initiate_async_receive_from(this), token,
-        buffers, &sender_endpoint, flags);
+        initiate_async_receive_from_coalesced(this), token,
+        buffers, &sender_endpoint, &segment_size, flags);
   }
 
 private:
@@ -1287,6 +1996,74 @@ private:
     basic_datagram_socket* self_;
   };
 
+  class initiate_async_send_to_many
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_send_to_many(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename WriteHandler>
+    void operator()(WriteHandler&& handler,
+        datagram_slot<const_buffer, endpoint_type>* slots, std::size_t count,
+        socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      BOOST_ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_send_to_many(
+          self_->impl_.get_implementation(), slots, count,
+          flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+
+  class initiate_async_send_to_segmented
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_send_to_segmented(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename WriteHandler, typename ConstBufferSequence>
+    void operator()(WriteHandler&& handler,
+        const ConstBufferSequence& buffers, const endpoint_type& destination,
+        std::size_t segment_size, socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      BOOST_ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_send_to_segmented(
+          self_->impl_.get_implementation(), buffers, destination,
+          segment_size, flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+
   class initiate_async_receive
   {
   public:
@@ -1321,6 +2098,36 @@ private:
     basic_datagram_socket* self_;
   };
 
+  class initiate_async_receive_provided
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_receive_provided(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename ReadHandler>
+    void operator()(ReadHandler&& handler, provided_buffer_ring* ring,
+        socket_base::message_flags flags) const
+    {
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_receive(
+          self_->impl_.get_implementation(),
+          static_cast<detail::provided_buffer_ring_base&>(*ring), flags,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+
   class initiate_async_receive_from
   {
   public:
@@ -1354,6 +2161,74 @@ private:
   private:
     basic_datagram_socket* self_;
   };
+
+  class initiate_async_receive_from_many
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_receive_from_many(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename ReadHandler>
+    void operator()(ReadHandler&& handler,
+        datagram_slot<mutable_buffer, endpoint_type>* slots, std::size_t count,
+        socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      BOOST_ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_receive_from_many(
+          self_->impl_.get_implementation(), slots, count,
+          flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+
+  class initiate_async_receive_from_coalesced
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_receive_from_coalesced(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename ReadHandler, typename MutableBufferSequence>
+    void operator()(ReadHandler&& handler,
+        const MutableBufferSequence& buffers, endpoint_type* sender_endpoint,
+        std::size_t* segment_size, socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      BOOST_ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_receive_from_coalesced(
+          self_->impl_.get_implementation(), buffers, *sender_endpoint,
+          *segment_size, flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
 };
 
 } // namespace asio
@@ -23,6 +23,7 @@
 #include <boost/asio/detail/non_const_lvalue.hpp>
 #include <boost/asio/detail/throw_error.hpp>
 #include <boost/asio/error.hpp>
+#include <boost/asio/provided_buffer_ring.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
 
@@ -64,6 +65,8 @@ class basic_stream_socket
 private:
   class initiate_async_send;
   class initiate_async_receive;
+  class initiate_async_receive_provided;
+  class initiate_async_send_then_receive;
 
 public:
   /// The type of the executor associated with the object.
@@ -822,6 +825,287 @@ public:
         initiate_async_receive(this), token, buffers, flags);
   }
 
+  /// Start an asynchronous receive into a buffer selected from a ring.
+  /**
+   * This function is used to asynchronously receive data from the stream
+   * socket into a buffer that is selected from a provided_buffer_ring only
+   * once data is available. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately.
+   *
+   * @param ring The ring from which a buffer will be selected. Ownership of
+   * the ring is retained by the caller, which must guarantee that it remains
+   * valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   boost::asio::provided_buffer buffer // The received data.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, boost::asio::provided_buffer)
+   * @endcode
+   *
+   * @note On success, the application must return the buffer to the ring by
+   * calling provided_buffer_ring::recycle() once it has finished with the
+   * data. If the ring has no free buffers the operation fails with
+   * boost::asio::error::no_buffer_space.
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        provided_buffer)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive(provided_buffer_ring& ring,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, provided_buffer)>(
+          declval<initiate_async_receive_provided>(), token,
+          &ring, socket_base::message_flags(0)))
+  {
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, provided_buffer)>(
+        initiate_async_receive_provided(this), token,
+        &ring, socket_base::message_flags(0));
+  }
+
+  /// Start an asynchronous receive into a buffer selected from a ring.
+  /**
+   * This function is used to asynchronously receive data from the stream
+   * socket into a buffer that is selected from a provided_buffer_ring only
+   * once data is available. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately.
+   *
+   * @param ring The ring from which a buffer will be selected. Ownership of
+   * the ring is retained by the caller, which must guarantee that it remains
+   * valid until the completion handler is called.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   boost::asio::provided_buffer buffer // The received data.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, boost::asio::provided_buffer)
+   * @endcode
+   *
+   * @note On success, the application must return the buffer to the ring by
+   * calling provided_buffer_ring::recycle() once it has finished with the
+   * data. If the ring has no free buffers the operation fails with
+   * boost::asio::error::no_buffer_space.
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        provided_buffer)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive(provided_buffer_ring& ring,
+      socket_base::message_flags flags,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, provided_buffer)>(
+          declval<initiate_async_receive_provided>(), token, &ring, flags))
+  {
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, provided_buffer)>(
+        initiate_async_receive_provided(this), token, &ring, flags);
+  }
+
+  /// Start an asynchronous send followed by an asynchronous receive.
+  /**
+   * This function is used to asynchronously send data on the stream socket
+   * and then receive data from it, such as when sending a request and waiting
+   * for its reply. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
+   *
+   * @param send_buffers One or more data buffers to be sent on the socket.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param receive_buffers One or more buffers into which the data will be
+   * received. Although the buffers object may be copied as necessary, ownership
+   * of the underlying memory blocks is retained by the caller, which must
+   * guarantee that they remain valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t bytes_sent, // Number of bytes sent.
+   *   std::size_t bytes_received // Number of bytes received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t, std::size_t) @endcode
+   *
+   * @note All of the data is sent before the receive is started, but the
+   * receive operation may not receive all of the requested number of bytes.
+   * The receive is performed only if the send succeeds. On Linux, when
+   * using the io_uring backend, the send and receive are submitted together as
+   * a linked chain, avoiding a round trip through the event loop between them.
+   *
+   * @par Example
+   * To send a request and receive a reply using single data buffers:
+   * @code
+   * socket.async_send_then_receive(
+   *     boost::asio::buffer(request), boost::asio::buffer(reply), handler);
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX or Windows operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename ConstBufferSequence, typename MutableBufferSequence,
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t, std::size_t)) ReadToken
+          = default_completion_token_t<executor_type>>
+  auto async_send_then_receive(const ConstBufferSequence& send_buffers,
+      const MutableBufferSequence& receive_buffers,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, std::size_t, std::size_t)>(
+          declval<initiate_async_send_then_receive>(), token, send_buffers,
+          receive_buffers, socket_base::message_flags(0)))
+  {
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, std::size_t, std::size_t)>(
+        initiate_async_send_then_receive(this), token, send_buffers,
+        receive_buffers, socket_base::message_flags(0));
+  }
+
+  /// Start an asynchronous send followed by an asynchronous receive.
+  /**
+   * This function is used to asynchronously send data on the stream socket
+   * and then receive data from it, such as when sending a request and waiting
+   * for its reply. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
+   *
+   * @param send_buffers One or more data buffers to be sent on the socket.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param receive_buffers One or more buffers into which the data will be
+   * received. Although the buffers object may be copied as necessary, ownership
+   * of the underlying memory blocks is retained by the caller, which must
+   * guarantee that they remain valid until the completion handler is called.
+   *
+   * @param flags Flags specifying how the send and receive calls are to be
+   * made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t bytes_sent, // Number of bytes sent.
+   *   std::size_t bytes_received // Number of bytes received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using boost::asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(boost::system::error_code, std::size_t, std::size_t) @endcode
+   *
+   * @note All of the data is sent before the receive is started, but the
+   * receive operation may not receive all of the requested number of bytes.
+   * The receive is performed only if the send succeeds. On Linux, when
+   * using the io_uring backend, the send and receive are submitted together as
+   * a linked chain, avoiding a round trip through the event loop between them.
+   *
+   * @par Example
+   * To send a request and receive a reply using single data buffers:
+   * @code
+   * socket.async_send_then_receive(
+   *     boost::asio::buffer(request), boost::asio::buffer(reply), 0, handler);
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX or Windows operating systems, this asynchronous operation supports
+   * cancellation for the following boost::asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename ConstBufferSequence, typename MutableBufferSequence,
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
+        std::size_t, std::size_t)) ReadToken
+          = default_completion_token_t<executor_type>>
+  auto async_send_then_receive(const ConstBufferSequence& send_buffers,
+      const MutableBufferSequence& receive_buffers,
+      socket_base::message_flags flags,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (boost::system::error_code, std::size_t, std::size_t)>(
+          declval<initiate_async_send_then_receive>(), token,
+          send_buffers, receive_buffers, flags))
+  {
+    return async_initiate<ReadToken,
+      void (boost::system::error_code, std::size_t, std::size_t)>(
+        initiate_async_send_then_receive(this), token,
+        send_buffers, receive_buffers, flags);
+  }
+
   /// Write some data to the socket.
   /**
    * This function is used to write data to the stream socket. The function call
@@ -1155,6 +1439,68 @@ private:
   private:
     basic_stream_socket* self_;
   };
+
+  class initiate_async_receive_provided
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_receive_provided(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename ReadHandler>
+    void operator()(ReadHandler&& handler, provided_buffer_ring* ring,
+        socket_base::message_flags flags) const
+    {
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_receive(
+          self_->impl_.get_implementation(),
+          static_cast<detail::provided_buffer_ring_base&>(*ring), flags,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
+
+  class initiate_async_send_then_receive
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_send_then_receive(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename ReadHandler, typename ConstBufferSequence,
+        typename MutableBufferSequence>
+    void operator()(ReadHandler&& handler,
+        const ConstBufferSequence& send_buffers,
+        const MutableBufferSequence& receive_buffers,
+        socket_base::message_flags flags) const
+    {
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_send_then_receive(
+          self_->impl_.get_implementation(), send_buffers, receive_buffers,
+          flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
 };
 
 } // namespace asio
@@ -517,6 +517,84 @@ public:
     return s;
   }
 
+  /// Get the timer's slack.
+  /**
+   * This function may be used to obtain the amount by which the expiry of the
+   * timer's asynchronous wait operations may be delayed.
+   */
+  duration slack() const
+  {
+    return impl_.get_service().slack(impl_.get_implementation());
+  }
+
+  /// Set the timer's slack.
+  /**
+   * This function sets the amount by which the expiry of the timer's
+   * asynchronous wait operations may be delayed, for timers such as idle
+   * timeouts that do not need to be precise. A non-zero slack has the
+   * following effects:
+   *
+   * @li The expiry time used for asynchronous wait operations is rounded up to
+   * a multiple of the slack, so that timers with similar expiry times share a
+   * single wakeup of the underlying event demultiplexer.
+   *
+   * @li When the timer's pending waits are cancelled, either explicitly or by
+   * changing the expiry time, the timer keeps its place in the
+   * implementation's timer queue. Starting a new wait with a later expiry time
+   * then only records that expiry time, and the timer is moved in the queue
+   * once its earlier place in the queue is reached.
+   *
+   * The slack does not affect the value returned by expiry() or the behaviour
+   * of wait(). Handlers are never invoked before the expiry time.
+   *
+   * @param slack The slack to be used for the timer. A zero slack, which is
+   * the default, disables these effects.
+   */
+  void slack(const duration& slack)
+  {
+    impl_.get_service().set_slack(impl_.get_implementation(), slack);
+  }
+
+  /// Set the timer's expiry time as an absolute time, without cancelling any
+  /// pending asynchronous wait operations.
+  /**
+   * This function sets the expiry time. Unlike expires_at(), any pending
+   * asynchronous wait operations remain pending, and complete at the new
+   * expiry time. A pending periodic wait next completes at the new expiry
+   * time, and then at intervals from that time.
+   *
+   * @param expiry_time The expiry time to be used for the timer.
+   *
+   * @throws boost::system::system_error Thrown on failure.
+   */
+  void reschedule_at(const time_point& expiry_time)
+  {
+    boost::system::error_code ec;
+    impl_.get_service().reschedule_at(
+        impl_.get_implementation(), expiry_time, ec);
+    boost::asio::detail::throw_error(ec, "reschedule_at");
+  }
+
+  /// Set the timer's expiry time relative to now, without cancelling any
+  /// pending asynchronous wait operations.
+  /**
+   * This function sets the expiry time. Unlike expires_after(), any pending
+   * asynchronous wait operations remain pending, and complete at the new
+   * expiry time. A pending periodic wait next completes at the new expiry
+   * time, and then at intervals from that time.
+   *
+   * @param expiry_time The expiry time to be used for the timer.
+   *
+   * @throws boost::system::system_error Thrown on failure.
+   */
+  void reschedule_after(const duration& expiry_time)
+  {
+    boost::system::error_code ec;
+    impl_.get_service().reschedule_after(
+        impl_.get_implementation(), expiry_time, ec);
+    boost::asio::detail::throw_error(ec, "reschedule_after");
+  }
+
   /// Perform a blocking wait on the timer.
   /**
    * This function is used to wait for the timer to expire. This function
@@ -596,6 +674,64 @@ public:
         initiate_async_wait(this), token);
   }
 
+  /// Start a periodic asynchronous wait on the timer.
+  /**
+   * This function may be used to initiate an asynchronous wait that completes
+   * at the timer's expiry time, and then each time the given interval has
+   * elapsed, until the wait is cancelled. It always returns immediately.
+   *
+   * A single operation is allocated for the lifetime of the wait, and is
+   * reused for each completion. The handler is copied for each invocation. It
+   * is called:
+   *
+   * @li Each time the period elapses, with a default-constructed error code.
+   * If the handler runs late enough that one or more periods have been
+   * missed, the next completion is one interval after the handler finished.
+   * If the handler exits with an exception, the wait continues.
+   *
+   * @li Exactly once when the wait is cancelled, for example by cancel(),
+   * expires_at(), the destruction of the timer, or the start of another
+   * periodic wait, in which case the handler is passed the error code
+   * boost::asio::error::operation_aborted.
+   *
+   * The value returned by expiry() is not changed by the completions. The
+   * reschedule_at() and reschedule_after() functions may be used to change
+   * the time of the next completion without cancelling the wait.
+   *
+   * @param interval The time between successive completions. Must be greater
+   * than zero.
+   *
+   * @param handler The handler to be called each time the timer expires. The
+   * handler must be copy constructible. The function signature of the handler
+   * must be:
+   * @code void handler(
+   *   const boost::system::error_code& error // Result of operation.
+   * ); @endcode
+   * The handler is never invoked from within this function.
+   *
+   * @throws boost::system::system_error Thrown if the interval is not greater
+   * than zero.
+   *
+   * @note This operation does not support per-operation cancellation.
+   */
+  template <typename WaitHandler>
+  void async_wait_periodic(const duration& interval, WaitHandler&& handler)
+  {
+    // If you get an error on the following line it means that your handler
+    // does not meet the documented type requirements for a WaitHandler.
+    BOOST_ASIO_WAIT_HANDLER_CHECK(WaitHandler, handler) type_check;
+
+    if (!(duration::zero() < interval))
+    {
+      boost::asio::detail::throw_error(
+          boost::asio::error::invalid_argument, "async_wait_periodic");
+    }
+
+    decay_t<WaitHandler> handler2(static_cast<WaitHandler&&>(handler));
+    impl_.get_service().async_wait_periodic(impl_.get_implementation(),
+        interval, handler2, impl_.get_executor());
+  }
+
 private:
   // Disallow copying and assignment.
   basic_waitable_timer(const basic_waitable_timer&) = delete;
@@ -0,0 +1,125 @@
+//
+// datagram_slot.hpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DATAGRAM_SLOT_HPP
+#define BOOST_ASIO_DATAGRAM_SLOT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+#include <boost/asio/buffer.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+/// Describes one datagram in a batched send or receive operation.
+/**
+ * A datagram slot associates a buffer with an endpoint. For a batched send
+ * operation, the buffer holds the datagram to be sent and the endpoint is its
+ * destination. For a batched receive operation, the buffer receives the
+ * datagram and the endpoint is updated to identify the sender.
+ *
+ * The Buffer template parameter must be either boost::asio::const_buffer or
+ * boost::asio::mutable_buffer.
+ */
+template <typename Buffer, typename Endpoint>
+class datagram_slot
+{
+public:
+  /// The type of the buffer.
+  typedef Buffer buffer_type;
+
+  /// The type of the endpoint.
+  typedef Endpoint endpoint_type;
+
+  /// Default constructor.
+  datagram_slot()
+    : buffer_(),
+      endpoint_(),
+      bytes_transferred_(0)
+  {
+  }
+
+  /// Construct a slot for receiving into the specified buffer.
+  explicit datagram_slot(const Buffer& buffer)
+    : buffer_(buffer),
+      endpoint_(),
+      bytes_transferred_(0)
+  {
+  }
+
+  /// Construct a slot holding the specified buffer and endpoint.
+  datagram_slot(const Buffer& buffer, const Endpoint& endpoint)
+    : buffer_(buffer),
+      endpoint_(endpoint),
+      bytes_transferred_(0)
+  {
+  }
+
+  /// Get the buffer associated with the slot.
+  const Buffer& buffer() const noexcept
+  {
+    return buffer_;
+  }
+
+  /// Set the buffer associated with the slot.
+  void buffer(const Buffer& buffer) noexcept
+  {
+    buffer_ = buffer;
+  }
+
+  /// Get the endpoint associated with the slot.
+  Endpoint& endpoint() noexcept
+  {
+    return endpoint_;
+  }
+
+  /// Get the endpoint associated with the slot.
+  const Endpoint& endpoint() const noexcept
+  {
+    return endpoint_;
+  }
+
+  /// Set the endpoint associated with the slot.
+  void endpoint(const Endpoint& endpoint)
+  {
+    endpoint_ = endpoint;
+  }
+
+  /// Get the number of bytes sent or received by the most recent operation to
+  /// transfer this slot's datagram.
+  std::size_t bytes_transferred() const noexcept
+  {
+    return bytes_transferred_;
+  }
+
+  /// Set the number of bytes transferred.
+  void bytes_transferred(std::size_t n) noexcept
+  {
+    bytes_transferred_ = n;
+  }
+
+private:
+  Buffer buffer_;
+  Endpoint endpoint_;
+  std::size_t bytes_transferred_;
+};
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DATAGRAM_SLOT_HPP
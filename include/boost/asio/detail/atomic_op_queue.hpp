@@ -0,0 +1,144 @@
+//
+// detail/atomic_op_queue.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_ATOMIC_OP_QUEUE_HPP
+#define BOOST_ASIO_DETAIL_ATOMIC_OP_QUEUE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+#include <boost/asio/detail/noncopyable.hpp>
+#include <boost/asio/detail/op_queue.hpp>
+
+#if !defined(BOOST_ASIO_HAS_THREADS)
+// Nothing to include.
+#else // !defined(BOOST_ASIO_HAS_THREADS)
+# include <atomic>
+#endif // !defined(BOOST_ASIO_HAS_THREADS)
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// A lock-free queue of operations that may be pushed by any number of threads
+// concurrently. Operations are removed all at once, in the order in which they
+// were pushed.
+template <typename Operation>
+class atomic_op_queue
+  : private noncopyable
+{
+public:
+  // Constructor.
+  atomic_op_queue()
+    : head_(0)
+  {
+  }
+
+  // Destructor destroys all operations.
+  ~atomic_op_queue()
+  {
+    op_queue<Operation> ops;
+    pop_all(ops);
+  }
+
+  // Push an operation on to the queue. Returns true if the queue was empty.
+  bool push(Operation* h)
+  {
+#if defined(BOOST_ASIO_HAS_THREADS)
+    Operation* head = head_.load(std::memory_order_relaxed);
+    do
+    {
+      op_queue_access::next(h, head);
+    } while (!head_.compare_exchange_weak(head, h,
+          std::memory_order_release, std::memory_order_relaxed));
+    return head == 0;
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    op_queue_access::next(h, head_);
+    bool was_empty = (head_ == 0);
+    head_ = h;
+    return was_empty;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+  }
+
+  // Move all operations on to the back of another queue.
+  void pop_all(op_queue<Operation>& ops)
+  {
+#if defined(BOOST_ASIO_HAS_THREADS)
+    if (head_.load(std::memory_order_relaxed) == 0)
+      return;
+    Operation* o = head_.exchange(0, std::memory_order_acquire);
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    Operation* o = head_;
+    head_ = 0;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+
+    push_reversed(o, ops);
+  }
+
+  // Move a list of operations, linked most recent first, on to the back of
+  // another queue in the order in which they were linked. Returns the number
+  // of operations moved.
+  static std::size_t push_reversed(Operation* o, op_queue<Operation>& ops)
+  {
+    // Reverse the list to restore the order in which the operations were
+    // linked.
+    Operation* reversed = 0;
+    std::size_t count = 0;
+    while (o)
+    {
+      Operation* next = op_queue_access::next(o);
+      op_queue_access::next(o, reversed);
+      reversed = o;
+      o = next;
+      ++count;
+    }
+
+    while (reversed)
+    {
+      Operation* next = op_queue_access::next(reversed);
+      ops.push(reversed);
+      reversed = next;
+    }
+
+    return count;
+  }
+
+  // Whether the queue is empty. The result may be out of date by the time it
+  // is used, unless the caller can otherwise ensure no push is in progress.
+  bool empty() const
+  {
+#if defined(BOOST_ASIO_HAS_THREADS)
+    return head_.load(std::memory_order_relaxed) == 0;
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    return head_ == 0;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+  }
+
+private:
+  // The most recently pushed operation.
+#if defined(BOOST_ASIO_HAS_THREADS)
+  std::atomic<Operation*> head_;
+#else // defined(BOOST_ASIO_HAS_THREADS)
+  Operation* head_;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_ATOMIC_OP_QUEUE_HPP
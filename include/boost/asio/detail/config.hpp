@@ -367,6 +367,12 @@
 # define BOOST_ASIO_DEFAULT_ALIGN alignof(std::max_align_t)
 #endif // defined(__GNUC__)
 
+// The size of a cache line, used to keep data that is frequently written by
+// different threads apart.
+#if !defined(BOOST_ASIO_CACHE_LINE_SIZE)
+# define BOOST_ASIO_CACHE_LINE_SIZE 64
+#endif // !defined(BOOST_ASIO_CACHE_LINE_SIZE)
+
 // Standard library support for aligned allocation.
 #if !defined(BOOST_ASIO_HAS_STD_ALIGNED_ALLOC)
 # if !defined(BOOST_ASIO_DISABLE_STD_ALIGNED_ALLOC)
@@ -1401,6 +1407,42 @@
 # endif // defined(_POSIX_VERSION)
 #endif // !defined(BOOST_ASIO_HAS_MSG_NOSIGNAL)
 
+// Kernel support for MSG_ZEROCOPY.
+#if !defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+# if !defined(BOOST_ASIO_DISABLE_MSG_ZEROCOPY)
+#  if defined(__linux__)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(4,14,0)
+#    define BOOST_ASIO_HAS_MSG_ZEROCOPY 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(4,14,0)
+#  endif // defined(__linux__)
+# endif // !defined(BOOST_ASIO_DISABLE_MSG_ZEROCOPY)
+#endif // !defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+
+// Kernel and library support for sendmmsg and recvmmsg.
+#if !defined(BOOST_ASIO_HAS_SENDMMSG)
+# if !defined(BOOST_ASIO_DISABLE_SENDMMSG)
+#  if defined(__linux__)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(3,0,0)
+#    if !defined(__GLIBC__) || (__GLIBC__ > 2) \
+       || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 14)
+#     define BOOST_ASIO_HAS_SENDMMSG 1
+#    endif // !defined(__GLIBC__) || (__GLIBC__ > 2) ...
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(3,0,0)
+#  endif // defined(__linux__)
+# endif // !defined(BOOST_ASIO_DISABLE_SENDMMSG)
+#endif // !defined(BOOST_ASIO_HAS_SENDMMSG)
+
+// Kernel support for UDP generic segmentation and receive offload.
+#if !defined(BOOST_ASIO_HAS_UDP_GSO)
+# if !defined(BOOST_ASIO_DISABLE_UDP_GSO)
+#  if defined(__linux__)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(5,0,0)
+#    define BOOST_ASIO_HAS_UDP_GSO 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(5,0,0)
+#  endif // defined(__linux__)
+# endif // !defined(BOOST_ASIO_DISABLE_UDP_GSO)
+#endif // !defined(BOOST_ASIO_HAS_UDP_GSO)
+
 // Standard library support for std::to_address.
 #if !defined(BOOST_ASIO_HAS_STD_TO_ADDRESS)
 # if !defined(BOOST_ASIO_DISABLE_STD_TO_ADDRESS)
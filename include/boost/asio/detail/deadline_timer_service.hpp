@@ -23,9 +23,11 @@
 #include <boost/asio/error.hpp>
 #include <boost/asio/execution_context.hpp>
 #include <boost/asio/detail/bind_handler.hpp>
+#include <boost/asio/detail/chrono_time_traits.hpp>
 #include <boost/asio/detail/fenced_block.hpp>
 #include <boost/asio/detail/memory.hpp>
 #include <boost/asio/detail/noncopyable.hpp>
+#include <boost/asio/detail/periodic_wait_handler.hpp>
 #include <boost/asio/detail/socket_ops.hpp>
 #include <boost/asio/detail/socket_types.hpp>
 #include <boost/asio/detail/timer_queue.hpp>
@@ -58,12 +60,17 @@ public:
   // The allocator type.
   typedef execution_context::allocator<void> allocator_type;
 
+  // The base class for periodic wait operations.
+  typedef typename timer_queue<TimeTraits, allocator_type>::periodic_op
+    periodic_op;
+
   // The implementation type of the timer. This type is dependent on the
   // underlying implementation of the timer service.
   struct implementation_type
     : private boost::asio::detail::noncopyable
   {
     time_type expiry;
+    duration_type slack;
     bool might_have_pending_waits;
     typename timer_queue<TimeTraits, allocator_type>::per_timer_data timer_data;
   };
@@ -73,7 +80,9 @@ public:
     : execution_context_service_base<
         deadline_timer_service<TimeTraits>>(context),
       timer_queue_(allocator_type(context),
-          config(context).get("timer", "heap_reserve", 0U)),
+          config(context).get("timer", "heap_reserve", 0U),
+          config(context).get("timer", "wheel_tick_usec", 0L)),
+      slack_origin_(TimeTraits::now()),
       scheduler_(boost::asio::use_service<timer_scheduler>(context))
   {
     scheduler_.init_task();
@@ -95,6 +104,7 @@ public:
   void construct(implementation_type& impl)
   {
     impl.expiry = time_type();
+    impl.slack = duration_type();
     impl.might_have_pending_waits = false;
   }
 
@@ -102,6 +112,7 @@ public:
   void destroy(implementation_type& impl)
   {
     boost::system::error_code ec;
+    impl.timer_data.set_lazy(false);
     cancel(impl, ec);
   }
 
@@ -118,6 +129,11 @@ public:
     impl.expiry = other_impl.expiry;
     other_impl.expiry = time_type();
 
+    impl.slack = other_impl.slack;
+    impl.timer_data.set_lazy(duration_type() < impl.slack);
+    other_impl.slack = duration_type();
+    other_impl.timer_data.set_lazy(false);
+
     impl.might_have_pending_waits = other_impl.might_have_pending_waits;
     other_impl.might_have_pending_waits = false;
   }
@@ -127,6 +143,7 @@ public:
       deadline_timer_service& other_service,
       implementation_type& other_impl)
   {
+    impl.timer_data.set_lazy(false);
     if (this != &other_service)
       if (impl.might_have_pending_waits)
         scheduler_.cancel_timer(timer_queue_, impl.timer_data);
@@ -137,6 +154,11 @@ public:
     impl.expiry = other_impl.expiry;
     other_impl.expiry = time_type();
 
+    impl.slack = other_impl.slack;
+    impl.timer_data.set_lazy(duration_type() < impl.slack);
+    other_impl.slack = duration_type();
+    other_impl.timer_data.set_lazy(false);
+
     impl.might_have_pending_waits = other_impl.might_have_pending_waits;
     other_impl.might_have_pending_waits = false;
   }
@@ -169,7 +191,11 @@ public:
           "deadline_timer", &impl, 0, "cancel"));
 
     std::size_t count = scheduler_.cancel_timer(timer_queue_, impl.timer_data);
-    impl.might_have_pending_waits = false;
+
+    // A timer with slack may remain in the queue after it is cancelled.
+    if (!(duration_type() < impl.slack))
+      impl.might_have_pending_waits = false;
+
     ec = boost::system::error_code();
     return count;
   }
@@ -189,7 +215,7 @@ public:
 
     std::size_t count = scheduler_.cancel_timer(
         timer_queue_, impl.timer_data, 1);
-    if (count == 0)
+    if (count == 0 && !(duration_type() < impl.slack))
       impl.might_have_pending_waits = false;
     ec = boost::system::error_code();
     return count;
@@ -207,6 +233,29 @@ public:
     return impl.expiry;
   }
 
+  // Get the slack for the timer.
+  duration_type slack(const implementation_type& impl) const
+  {
+    return impl.slack;
+  }
+
+  // Set the slack for the timer. A timer with slack is removed from the
+  // timer queue only when it expires or is destroyed, so that rearming it
+  // with a later expiry time does not change the queue.
+  void set_slack(implementation_type& impl, const duration_type& slack)
+  {
+    if (duration_type() < impl.slack && !(duration_type() < slack))
+    {
+      // Remove the timer from the queue if it was left there when cancelled.
+      impl.timer_data.set_lazy(false);
+      if (impl.might_have_pending_waits)
+        scheduler_.cancel_timer(timer_queue_, impl.timer_data, 0);
+    }
+
+    impl.slack = slack;
+    impl.timer_data.set_lazy(duration_type() < slack);
+  }
+
   // Get the expiry time for the timer relative to now.
   duration_type expires_from_now(const implementation_type& impl) const
   {
@@ -239,6 +288,31 @@ public:
         TimeTraits::add(TimeTraits::now(), expiry_time), ec);
   }
 
+  // Set the expiry time for the timer as an absolute time, without cancelling
+  // any pending asynchronous wait operations.
+  void reschedule_at(implementation_type& impl,
+      const time_type& expiry_time, boost::system::error_code& ec)
+  {
+    impl.expiry = expiry_time;
+    if (impl.might_have_pending_waits)
+    {
+      BOOST_ASIO_HANDLER_OPERATION((scheduler_.context(),
+            "deadline_timer", &impl, 0, "reschedule_at"));
+
+      scheduler_.reschedule_timer(timer_queue_,
+          coarse_expiry(impl, static_cast<TimeTraits*>(0)), impl.timer_data);
+    }
+    ec = boost::system::error_code();
+  }
+
+  // Set the expiry time for the timer relative to now, without cancelling any
+  // pending asynchronous wait operations.
+  void reschedule_after(implementation_type& impl,
+      const duration_type& expiry_time, boost::system::error_code& ec)
+  {
+    reschedule_at(impl, TimeTraits::add(TimeTraits::now(), expiry_time), ec);
+  }
+
   // Perform a blocking wait on the timer.
   void wait(implementation_type& impl, boost::system::error_code& ec)
   {
@@ -278,11 +352,70 @@ public:
     BOOST_ASIO_HANDLER_CREATION((scheduler_.context(),
           *p.p, "deadline_timer", &impl, 0, "async_wait"));
 
-    scheduler_.schedule_timer(timer_queue_, impl.expiry, impl.timer_data, p.p);
+    scheduler_.schedule_timer(timer_queue_,
+        coarse_expiry(impl, static_cast<TimeTraits*>(0)),
+        impl.timer_data, p.p);
     p.v = p.p = 0;
   }
 
+  // Start an asynchronous wait that completes at the timer's expiry time and
+  // then at each following interval, until it is cancelled.
+  template <typename Handler, typename IoExecutor>
+  void async_wait_periodic(implementation_type& impl,
+      const duration_type& interval, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    // Allocate and construct an operation to wrap the handler.
+    typedef periodic_wait_handler<Handler,
+      IoExecutor, deadline_timer_service> op;
+    typename op::ptr p = { boost::asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(handler, io_ex, *this,
+        coarse_expiry(impl, static_cast<TimeTraits*>(0)), interval);
+
+    impl.might_have_pending_waits = true;
+
+    BOOST_ASIO_HANDLER_CREATION((scheduler_.context(),
+          *p.p, "deadline_timer", &impl, 0, "async_wait_periodic"));
+
+    scheduler_.schedule_periodic_timer(timer_queue_, impl.timer_data, p.p);
+    p.v = p.p = 0;
+  }
+
+  // Queue a periodic wait operation again after it has completed. Returns
+  // false if the scheduler has been shut down.
+  bool requeue_periodic(periodic_op* op)
+  {
+    return scheduler_.requeue_periodic_timer(timer_queue_, op);
+  }
+
 private:
+  // Round a timer's expiry time up to the next multiple of its slack, so that
+  // timers with similar expiry times expire together.
+  template <typename Clock, typename WaitTraits>
+  time_type coarse_expiry(const implementation_type& impl,
+      chrono_time_traits<Clock, WaitTraits>*) const
+  {
+    if (!(duration_type() < impl.slack)
+        || impl.expiry < slack_origin_
+        || (duration_type::max)() - impl.slack
+          < TimeTraits::subtract(impl.expiry, slack_origin_))
+      return impl.expiry;
+
+    duration_type d = TimeTraits::subtract(impl.expiry, slack_origin_);
+    typename duration_type::rep n = d / impl.slack;
+    if (impl.slack * n < d)
+      ++n;
+    return TimeTraits::add(slack_origin_, impl.slack * n);
+  }
+
+  // Slack is supported only for timers based on chrono clocks.
+  template <typename T>
+  time_type coarse_expiry(const implementation_type& impl, T*) const
+  {
+    return impl.expiry;
+  }
+
   // Helper function to wait given a duration type. The duration type should
   // either be of type boost::posix_time::time_duration, or implement the
   // required subset of its interface.
@@ -334,6 +467,9 @@ private:
   // The queue of timers.
   timer_queue<TimeTraits, allocator_type> timer_queue_;
 
+  // The time from which expiry times are rounded to multiples of the slack.
+  const time_type slack_origin_;
+
   // The object that schedules and executes timers. Usually a reactor.
   timer_scheduler& scheduler_;
 };
@@ -32,6 +32,7 @@
 #include <boost/asio/detail/timer_queue_set.hpp>
 #include <boost/asio/detail/wait_op.hpp>
 #include <boost/asio/execution_context.hpp>
+#include <sys/epoll.h>
 
 #if defined(BOOST_ASIO_HAS_TIMERFD)
 # include <sys/timerfd.h>
@@ -68,6 +69,8 @@ public:
     op_queue<reactor_op> op_queue_[max_ops];
     bool try_speculative_[max_ops];
     bool shutdown_;
+    bool listening_;
+    unsigned int zero_copy_sequence_;
 
     BOOST_ASIO_DECL descriptor_state(bool locking, int spin_count);
     void set_ready_events(uint32_t events) { task_result_ = events; }
@@ -108,6 +111,24 @@ public:
       int op_type, socket_type descriptor,
       per_descriptor_data& descriptor_data, reactor_op* op);
 
+  // Re-register a listening socket so that, if the same socket is registered
+  // with more than one reactor, each new connection wakes only one of them.
+  // Has no effect unless enabled by configuration. Must only be called for a
+  // socket that is known to be listening, and only the first call for a
+  // descriptor has any effect. As epoll does not allow the events of an
+  // exclusive registration to be changed using EPOLL_CTL_MOD, only read
+  // operations may then be started on the descriptor.
+  BOOST_ASIO_DECL void register_listening_descriptor(socket_type descriptor,
+      per_descriptor_data& descriptor_data);
+
+  // Get the sequence number of the next zero-copy send on a descriptor. The
+  // number is protected by the descriptor's lock, which is held while the
+  // descriptor's operations are performed.
+  unsigned int* zero_copy_sequence(per_descriptor_data& descriptor_data)
+  {
+    return descriptor_data ? &descriptor_data->zero_copy_sequence_ : 0;
+  }
+
   // Move descriptor registration from one descriptor_data object to another.
   BOOST_ASIO_DECL void move_descriptor(socket_type descriptor,
       per_descriptor_data& target_descriptor_data,
@@ -204,6 +225,26 @@ public:
       typename timer_queue<TimeTraits, Allocator>::per_timer_data& target,
       typename timer_queue<TimeTraits, Allocator>::per_timer_data& source);
 
+  // Change the expiry time of the timer operations associated with the given
+  // timer, without cancelling them.
+  template <typename TimeTraits, typename Allocator>
+  void reschedule_timer(timer_queue<TimeTraits, Allocator>& queue,
+      const typename TimeTraits::time_type& time,
+      typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer);
+
+  // Schedule a periodic operation associated with the given timer, cancelling
+  // any periodic operation that is already associated with the timer.
+  template <typename TimeTraits, typename Allocator>
+  void schedule_periodic_timer(timer_queue<TimeTraits, Allocator>& queue,
+      typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer,
+      typename timer_queue<TimeTraits, Allocator>::periodic_op* op);
+
+  // Schedule a periodic operation that has completed to expire again. Returns
+  // false if the scheduler has been shut down.
+  template <typename TimeTraits, typename Allocator>
+  bool requeue_periodic_timer(timer_queue<TimeTraits, Allocator>& queue,
+      typename timer_queue<TimeTraits, Allocator>::periodic_op* op);
+
   // Run epoll once until interrupted or events are ready to be dispatched.
   BOOST_ASIO_DECL void run(long usec, op_queue<operation>& ops);
 
@@ -262,12 +303,22 @@ private:
   // The timer file descriptor.
   int timer_fd_;
 
+  // The maximum number of events to obtain from a single epoll_wait call.
+  const int batch_size_;
+
+  // The buffer that receives events from epoll_wait. Only the thread that is
+  // running the task may use it.
+  epoll_event* events_;
+
   // The timer queues.
   timer_queue_set timer_queues_;
 
   // Whether the service has been shut down.
   bool shutdown_;
 
+  // Whether listening sockets are registered for exclusive wakeups.
+  const bool exclusive_listeners_;
+
   // Whether I/O locking is enabled.
   const bool io_locking_;
 
@@ -0,0 +1,323 @@
+//
+// detail/handler_arena.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_HANDLER_ARENA_HPP
+#define BOOST_ASIO_DETAIL_HANDLER_ARENA_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+#include <new>
+#include <boost/asio/detail/memory.hpp>
+#include <boost/asio/detail/noncopyable.hpp>
+
+#if !defined(BOOST_ASIO_HAS_THREADS)
+// Nothing to include.
+#else // !defined(BOOST_ASIO_HAS_THREADS)
+# include <atomic>
+#endif // !defined(BOOST_ASIO_HAS_THREADS)
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// A per-thread cache of small memory blocks, grouped into size classes. A
+// block may be freed by any thread. Blocks freed by a thread other than the
+// owner are returned to the owner through a lock-free list, and are reused
+// once the owner runs out of blocks of the required size.
+//
+// While in use, the byte following the requested size of each block is zero,
+// and the block is preceded by a header identifying its owner.
+class handler_arena
+  : private noncopyable
+{
+public:
+  // The smallest size that is not allocated from the arena.
+  enum { max_size = 512 };
+
+  // Constructor.
+  handler_arena()
+    : outstanding_(0),
+      remote_list_(0),
+      orphaned_outstanding_(0)
+  {
+    for (std::size_t i = 0; i < num_classes; ++i)
+    {
+      free_lists_[i] = 0;
+      free_counts_[i] = 0;
+    }
+  }
+
+  // Whether a request may be satisfied from an arena.
+  static bool is_eligible(std::size_t size, std::size_t align)
+  {
+    return size > 0 && size < max_size && align <= BOOST_ASIO_DEFAULT_ALIGN;
+  }
+
+  // Whether a block that is in use was allocated from an arena. The block
+  // must have been allocated with a size for which is_eligible() is true, or
+  // have a non-zero byte following the requested size.
+  static bool is_arena_block(void* pointer, std::size_t size)
+  {
+    return size > 0 && size < max_size
+      && static_cast<unsigned char*>(pointer)[size] == 0;
+  }
+
+  // Allocate a block. Must be called only by the owning thread.
+  void* allocate(std::size_t size)
+  {
+    std::size_t size_class = size_class_of(size);
+    void* pointer = free_lists_[size_class];
+    if (!pointer)
+    {
+      reclaim_remote_blocks();
+      pointer = free_lists_[size_class];
+    }
+
+    if (pointer)
+    {
+      free_lists_[size_class] = next(pointer);
+      --free_counts_[size_class];
+    }
+    else
+    {
+      void* base = aligned_new(BOOST_ASIO_DEFAULT_ALIGN,
+          header_size + class_size(size_class));
+      header* h = new (base) header;
+      h->owner_ = this;
+      h->size_class_ = size_class;
+      pointer = static_cast<unsigned char*>(base) + header_size;
+    }
+
+    ++outstanding_;
+    static_cast<unsigned char*>(pointer)[size] = 0;
+    return pointer;
+  }
+
+  // Deallocate a block. May be called by any thread. The this_arena argument
+  // is the calling thread's own arena, if any.
+  static void deallocate(handler_arena* this_arena, void* pointer)
+  {
+    header* h = header_of(pointer);
+    if (h->owner_ == this_arena)
+      this_arena->free_local(pointer, h->size_class_);
+    else
+      h->owner_->free_remote(pointer);
+  }
+
+  // Called by the owning thread when it will make no further allocations. The
+  // arena is destroyed once all of its blocks have been deallocated.
+  void release()
+  {
+    free_list(exchange_remote_list(orphaned_marker()), true);
+    for (std::size_t i = 0; i < num_classes; ++i)
+    {
+      free_list(free_lists_[i], false);
+      free_lists_[i] = 0;
+    }
+
+#if defined(BOOST_ASIO_HAS_THREADS)
+    long remaining = outstanding_;
+    if (orphaned_outstanding_.fetch_add(remaining,
+          std::memory_order_acq_rel) + remaining == 0)
+      delete this;
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    if (outstanding_ == 0)
+      delete this;
+    else
+      orphaned_outstanding_ = outstanding_;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+  }
+
+private:
+  ~handler_arena()
+  {
+  }
+
+  enum
+  {
+    // The size of the smallest size class.
+    min_class_size = 32,
+
+    // The number of size classes. Each is twice the size of the previous one.
+    num_classes = 5,
+
+    // The maximum number of unused blocks kept for each size class.
+    max_free_blocks = 64
+  };
+
+  // The header that precedes each block.
+  struct header
+  {
+    handler_arena* owner_;
+    std::size_t size_class_;
+  };
+
+  // The size of the header, preserving the default alignment of the block.
+  enum
+  {
+    header_size = (sizeof(header) + BOOST_ASIO_DEFAULT_ALIGN - 1)
+      / BOOST_ASIO_DEFAULT_ALIGN * BOOST_ASIO_DEFAULT_ALIGN
+  };
+
+  static std::size_t class_size(std::size_t size_class)
+  {
+    return static_cast<std::size_t>(min_class_size) << size_class;
+  }
+
+  // Get the smallest size class with room for the requested size followed by
+  // the marker byte.
+  static std::size_t size_class_of(std::size_t size)
+  {
+    std::size_t size_class = 0;
+    while (class_size(size_class) <= size)
+      ++size_class;
+    return size_class;
+  }
+
+  static header* header_of(void* pointer)
+  {
+    return static_cast<header*>(static_cast<void*>(
+          static_cast<unsigned char*>(pointer) - header_size));
+  }
+
+  // Unused blocks are linked through their first bytes.
+  static void*& next(void* pointer)
+  {
+    return *static_cast<void**>(pointer);
+  }
+
+  // Free a block on the owning thread.
+  void free_local(void* pointer, std::size_t size_class)
+  {
+    --outstanding_;
+    if (free_counts_[size_class] < max_free_blocks)
+    {
+      next(pointer) = free_lists_[size_class];
+      free_lists_[size_class] = pointer;
+      ++free_counts_[size_class];
+    }
+    else
+    {
+      aligned_delete(header_of(pointer));
+    }
+  }
+
+  // Free a block on a thread other than the owner.
+  void free_remote(void* pointer)
+  {
+#if defined(BOOST_ASIO_HAS_THREADS)
+    void* head = remote_list_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      if (head == orphaned_marker())
+      {
+        aligned_delete(header_of(pointer));
+        if (orphaned_outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+          delete this;
+        return;
+      }
+
+      next(pointer) = head;
+      if (remote_list_.compare_exchange_weak(head, pointer,
+            std::memory_order_release, std::memory_order_relaxed))
+        return;
+    }
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    // Without threads, a block can only be freed by a thread other than its
+    // owner after the owner has released the arena.
+    aligned_delete(header_of(pointer));
+    if (--orphaned_outstanding_ == 0)
+      delete this;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+  }
+
+  // Move the blocks freed by other threads on to the free lists.
+  void reclaim_remote_blocks()
+  {
+#if defined(BOOST_ASIO_HAS_THREADS)
+    if (remote_list_.load(std::memory_order_relaxed) == 0)
+      return;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+
+    void* pointer = exchange_remote_list(0);
+    while (pointer)
+    {
+      void* next_pointer = next(pointer);
+      free_local(pointer, header_of(pointer)->size_class_);
+      pointer = next_pointer;
+    }
+  }
+
+  void* exchange_remote_list(void* new_head)
+  {
+#if defined(BOOST_ASIO_HAS_THREADS)
+    return remote_list_.exchange(new_head, std::memory_order_acquire);
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    void* head = remote_list_;
+    remote_list_ = new_head;
+    return head;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+  }
+
+  // Free a list of blocks. The outstanding count is reduced if the blocks were
+  // freed by other threads.
+  void free_list(void* pointer, bool remote)
+  {
+    while (pointer)
+    {
+      void* next_pointer = next(pointer);
+      aligned_delete(header_of(pointer));
+      if (remote)
+        --outstanding_;
+      pointer = next_pointer;
+    }
+  }
+
+  // A value for the head of the remote list indicating that the owner has
+  // released the arena, after which other threads free blocks directly.
+  void* orphaned_marker()
+  {
+    return &orphaned_outstanding_;
+  }
+
+  // The unused blocks of each size class. Accessed only by the owner.
+  void* free_lists_[num_classes];
+  std::size_t free_counts_[num_classes];
+
+  // The number of blocks allocated and not yet returned to the free lists.
+  // Accessed only by the owner.
+  long outstanding_;
+
+#if defined(BOOST_ASIO_HAS_THREADS)
+  // The blocks freed by other threads.
+  std::atomic<void*> remote_list_;
+
+  // The number of blocks yet to be freed after the owner has released the
+  // arena. May be temporarily negative.
+  std::atomic<long> orphaned_outstanding_;
+#else // defined(BOOST_ASIO_HAS_THREADS)
+  void* remote_list_;
+  long orphaned_outstanding_;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_HANDLER_ARENA_HPP
@@ -46,15 +46,25 @@ epoll_reactor::epoll_reactor(boost::asio::execution_context& ctx)
     epoll_fd_(do_epoll_create()),
     timer_fd_(config(ctx).get("reactor", "use_timerfd", true)
         ? do_timerfd_create() : -1),
+    batch_size_(config(ctx).get("reactor", "epoll_batch_size", 128) > 0
+        ? config(ctx).get("reactor", "epoll_batch_size", 128) : 1),
+    events_(0),
     shutdown_(false),
+    exclusive_listeners_(config(ctx).get("reactor", "epoll_exclusive", false)),
     io_locking_(config(ctx).get("reactor", "io_locking", true)),
     io_locking_spin_count_(
         config(ctx).get("reactor", "io_locking_spin_count", 0)),
     registered_descriptors_mutex_(mutex_.enabled(), mutex_.spin_count()),
     registered_descriptors_(execution_context::allocator<void>(ctx),
         config(ctx).get("reactor", "preallocated_io_objects", 0U),
+        config(ctx).get("reactor", "io_object_slab_size", 1U),
         io_locking_, io_locking_spin_count_)
 {
+  // The buffer is allocated once all members have been constructed, so that
+  // it is not leaked if a member's constructor throws.
+  events_ = execution_context::allocator<epoll_event>(ctx).allocate(
+      static_cast<std::size_t>(batch_size_));
+
   // Add the interrupter's descriptor to epoll.
   epoll_event ev = { 0, { 0 } };
   ev.events = EPOLLIN | EPOLLERR | EPOLLET;
@@ -77,6 +87,8 @@ epoll_reactor::~epoll_reactor()
     close(epoll_fd_);
   if (timer_fd_ != -1)
     close(timer_fd_);
+  execution_context::allocator<epoll_event>(context()).deallocate(
+      events_, static_cast<std::size_t>(batch_size_));
 }
 
 void epoll_reactor::shutdown()
@@ -178,6 +190,8 @@ int epoll_reactor::register_descriptor(socket_type descriptor,
     descriptor_data->reactor_ = this;
     descriptor_data->descriptor_ = descriptor;
     descriptor_data->shutdown_ = false;
+    descriptor_data->listening_ = false;
+    descriptor_data->zero_copy_sequence_ = 0;
     for (int i = 0; i < max_ops; ++i)
       descriptor_data->try_speculative_[i] = true;
   }
@@ -220,6 +234,8 @@ int epoll_reactor::register_internal_descriptor(
     descriptor_data->reactor_ = this;
     descriptor_data->descriptor_ = descriptor;
     descriptor_data->shutdown_ = false;
+    descriptor_data->listening_ = false;
+    descriptor_data->zero_copy_sequence_ = 0;
     descriptor_data->op_queue_[op_type].push(op);
     for (int i = 0; i < max_ops; ++i)
       descriptor_data->try_speculative_[i] = true;
@@ -240,6 +256,45 @@ int epoll_reactor::register_internal_descriptor(
   return 0;
 }
 
+void epoll_reactor::register_listening_descriptor(socket_type descriptor,
+    epoll_reactor::per_descriptor_data& descriptor_data)
+{
+#if defined(EPOLLEXCLUSIVE)
+  if (!exclusive_listeners_ || !descriptor_data)
+    return;
+
+  mutex::scoped_lock descriptor_lock(descriptor_data->mutex_);
+
+  if (descriptor_data->shutdown_
+      || descriptor_data->listening_
+      || descriptor_data->registered_events_ == 0)
+    return;
+
+  descriptor_data->listening_ = true;
+
+  // The exclusive flag may only be specified when a descriptor is added, and
+  // only with a restricted set of events. Adding a descriptor reports its
+  // current readiness, so no connections are missed between the two calls.
+  epoll_event ev = { 0, { 0 } };
+  epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, descriptor, &ev);
+  ev.events = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLET | EPOLLEXCLUSIVE;
+  ev.data.ptr = descriptor_data;
+  if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, descriptor, &ev) == 0)
+  {
+    descriptor_data->registered_events_ = ev.events;
+  }
+  else
+  {
+    // Exclusive wakeups are not supported, so restore the original events.
+    ev.events = descriptor_data->registered_events_;
+    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, descriptor, &ev);
+  }
+#else // defined(EPOLLEXCLUSIVE)
+  (void)descriptor;
+  (void)descriptor_data;
+#endif // defined(EPOLLEXCLUSIVE)
+}
+
 void epoll_reactor::move_descriptor(socket_type,
     epoll_reactor::per_descriptor_data& target_descriptor_data,
     epoll_reactor::per_descriptor_data& source_descriptor_data)
@@ -276,6 +331,18 @@ void epoll_reactor::start_op(int op_type, socket_type descriptor,
     return;
   }
 
+#if defined(EPOLLEXCLUSIVE)
+  // The events of an exclusive registration cannot be modified, so it only
+  // ever reports readability.
+  if (op_type != read_op
+      && (descriptor_data->registered_events_ & EPOLLEXCLUSIVE) != 0)
+  {
+    op->ec_ = boost::asio::error::operation_not_supported;
+    on_immediate(op, is_continuation, immediate_arg);
+    return;
+  }
+#endif // defined(EPOLLEXCLUSIVE)
+
   if (descriptor_data->op_queue_[op_type].empty())
   {
     if (allow_speculative
@@ -524,8 +591,8 @@ void epoll_reactor::run(long usec, op_queue<operation>& ops)
   }
 
   // Block on the epoll descriptor.
-  epoll_event events[128];
-  int num_events = epoll_wait(epoll_fd_, events, 128, timeout);
+  epoll_event* events = events_;
+  int num_events = epoll_wait(epoll_fd_, events, batch_size_, timeout);
 
 #if defined(BOOST_ASIO_ENABLE_HANDLER_TRACKING)
   // Trace the waiting events.
@@ -109,6 +109,69 @@ void io_uring_service::move_timer(timer_queue<TimeTraits, Allocator>& queue,
   scheduler_.post_deferred_completions(ops);
 }
 
+template <typename TimeTraits, typename Allocator>
+void io_uring_service::reschedule_timer(
+    timer_queue<TimeTraits, Allocator>& queue,
+    const typename TimeTraits::time_type& time,
+    typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer)
+{
+  mutex::scoped_lock lock(mutex_);
+  bool earliest = queue.reschedule_timer(time, timer);
+  if (earliest)
+  {
+    update_timeout();
+    post_submit_sqes_op(lock);
+  }
+}
+
+template <typename TimeTraits, typename Allocator>
+void io_uring_service::schedule_periodic_timer(
+    timer_queue<TimeTraits, Allocator>& queue,
+    typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer,
+    typename timer_queue<TimeTraits, Allocator>::periodic_op* op)
+{
+  mutex::scoped_lock lock(mutex_);
+
+  if (shutdown_)
+  {
+    scheduler_.post_immediate_completion(op, false);
+    return;
+  }
+
+  op_queue<operation> ops;
+  bool earliest = queue.enqueue_periodic(timer, op, ops);
+  scheduler_.work_started();
+  if (earliest)
+  {
+    update_timeout();
+    post_submit_sqes_op(lock);
+  }
+  lock.unlock();
+  scheduler_.post_deferred_completions(ops);
+}
+
+template <typename TimeTraits, typename Allocator>
+bool io_uring_service::requeue_periodic_timer(
+    timer_queue<TimeTraits, Allocator>& queue,
+    typename timer_queue<TimeTraits, Allocator>::periodic_op* op)
+{
+  mutex::scoped_lock lock(mutex_);
+
+  if (shutdown_)
+    return false;
+
+  bool earliest = false;
+  queue.requeue_periodic(op, earliest);
+
+  scheduler_.work_started();
+  if (earliest)
+  {
+    update_timeout();
+    post_submit_sqes_op(lock);
+  }
+  return true;
+}
+
 } // namespace detail
 } // namespace asio
 } // namespace boost
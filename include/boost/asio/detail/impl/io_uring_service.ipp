@@ -20,7 +20,9 @@
 #if defined(BOOST_ASIO_HAS_IO_URING)
 
 #include <cstddef>
+#include <sched.h>
 #include <sys/eventfd.h>
+#include <time.h>
 #include <boost/asio/detail/io_uring_service.hpp>
 #include <boost/asio/detail/reactor_op.hpp>
 #include <boost/asio/detail/scheduler.hpp>
@@ -46,15 +48,35 @@ io_uring_service::io_uring_service(boost::asio::execution_context& ctx)
     io_locking_(config(ctx).get("reactor", "io_locking", true)),
     io_locking_spin_count_(
         config(ctx).get("reactor", "io_locking_spin_count", 0)),
+    setup_flags_(config(ctx).get("reactor", "io_uring_setup_flags", 0U)),
+    sqpoll_idle_(config(ctx).get("reactor", "io_uring_sqpoll_idle", 0U)),
+    sqpoll_cpu_(config(ctx).get("reactor", "io_uring_sqpoll_cpu", -1)),
+    single_issuer_(false),
+    ring_enabled_(true),
     timeout_(),
+    timeout_expiry_(0),
+    timeout_update_(),
+    timeout_update_pending_(false),
+    timeout_update_supported_(true),
     registration_mutex_(mutex_.enabled()),
     registered_io_objects_(execution_context::allocator<void>(ctx),
         config(ctx).get("reactor", "preallocated_io_objects", 0U),
+        config(ctx).get("reactor", "io_object_slab_size", 1U),
         io_locking_, io_locking_spin_count_),
     reactor_(use_service<reactor>(ctx)),
     reactor_data_(),
-    event_fd_(-1)
+    event_fd_(-1),
+    event_fd_io_object_(0),
+    next_buffer_group_(0),
+    registered_files_(config(ctx).get("reactor", "registered_files", 0U), -1)
 {
+  for (std::size_t i = registered_files_.size(); i > 0; --i)
+    free_files_.push_back(static_cast<int>(i - 1));
+
+#if defined(IORING_SETUP_SINGLE_ISSUER)
+  single_issuer_ = (setup_flags_ & IORING_SETUP_SINGLE_ISSUER) != 0;
+#endif // defined(IORING_SETUP_SINGLE_ISSUER)
+
   reactor_.init_task();
   init_ring();
   register_with_reactor();
@@ -81,12 +103,14 @@ void io_uring_service::shutdown()
   {
     for (int i = 0; i < max_ops; ++i)
     {
-      if (!io_obj->queues_[i].op_queue_.empty())
+      if (!io_obj->queues_[i].op_queue_.empty()
+          || io_obj->queues_[i].multishot_armed_)
       {
         ops.push(io_obj->queues_[i].op_queue_);
         if (::io_uring_sqe* sqe = get_sqe())
           ::io_uring_prep_cancel(sqe, &io_obj->queues_[i], 0);
       }
+      io_obj->queues_[i].discard_multishot_results();
     }
     io_obj->shutdown_ = true;
     registered_io_objects_.free(io_obj);
@@ -98,11 +122,14 @@ void io_uring_service::shutdown()
   submit_sqes();
 
   // Wait for all completions to come back.
-  for (; outstanding_work_ > 0; --outstanding_work_)
+  while (outstanding_work_ > 0)
   {
     ::io_uring_cqe* cqe = 0;
     if (::io_uring_wait_cqe(&ring_, &cqe) != 0)
       break;
+    if (is_final_cqe(cqe))
+      --outstanding_work_;
+    ::io_uring_cqe_seen(&ring_, cqe);
   }
 
   timer_queues_.get_all_timers(ops);
@@ -126,7 +153,8 @@ void io_uring_service::notify_fork(
         mutex::scoped_lock io_object_lock(io_obj->mutex_);
         for (int i = 0; i < max_ops; ++i)
         {
-          if (!io_obj->queues_[i].op_queue_.empty()
+          if ((!io_obj->queues_[i].op_queue_.empty()
+                || io_obj->queues_[i].multishot_armed_)
               && !io_obj->queues_[i].cancel_requested_)
           {
             mutex::scoped_lock lock(mutex_);
@@ -149,23 +177,50 @@ void io_uring_service::notify_fork(
       // completed, or were explicitly cancelled. All others will be
       // automatically restarted.
       op_queue<operation> ops;
-      for (; outstanding_work_ > 0; --outstanding_work_)
+      while (outstanding_work_ > 0)
       {
         ::io_uring_cqe* cqe = 0;
         if (::io_uring_wait_cqe(&ring_, &cqe) != 0)
           break;
         if (void* ptr = ::io_uring_cqe_get_data(cqe))
         {
-          if (ptr != this && ptr != &timer_queues_ && ptr != &timeout_)
+          if (ptr != this && ptr != &timer_queues_
+              && ptr != &timeout_ && ptr != &timeout_update_)
           {
             io_queue* io_q = static_cast<io_queue*>(ptr);
-            io_q->set_result(cqe->res);
-            ops.push(io_q);
+            if (io_q == &io_q->io_object_->queues_[multishot_op])
+            {
+              if (io_q->push_multishot_result(cqe->res, cqe->flags))
+                ops.push(io_q);
+            }
+            else if ((cqe->flags & IORING_CQE_F_NOTIF) != 0)
+            {
+              // The buffers of a zero-copy send have been released, so the
+              // result saved from the send's first completion is delivered.
+              ops.push(io_q);
+            }
+            else
+            {
+              io_q->set_result(cqe->res, cqe->flags);
+              if (is_final_cqe(cqe))
+                ops.push(io_q);
+            }
           }
         }
+        if (is_final_cqe(cqe))
+          --outstanding_work_;
+        ::io_uring_cqe_seen(&ring_, cqe);
       }
       scheduler_.post_deferred_completions(ops);
 
+      // The timeout has been cancelled, and is restarted after the fork.
+      {
+        mutex::scoped_lock lock(mutex_);
+        timeout_.tv_sec = 0;
+        timeout_.tv_nsec = 0;
+        timeout_update_pending_ = false;
+      }
+
       // Restart and eventfd operation.
       register_with_reactor();
     }
@@ -196,7 +251,7 @@ void io_uring_service::init_task()
 }
 
 void io_uring_service::register_io_object(
-    io_uring_service::per_io_object_data& io_obj)
+    io_uring_service::per_io_object_data& io_obj, int descriptor)
 {
   io_obj = allocate_io_object();
 
@@ -204,10 +259,17 @@ void io_uring_service::register_io_object(
 
   io_obj->service_ = this;
   io_obj->shutdown_ = false;
+  io_obj->descriptor_ = descriptor;
+  io_obj->file_index_ = register_file(descriptor);
   for (int i = 0; i < max_ops; ++i)
   {
     io_obj->queues_[i].io_object_ = io_obj;
     io_obj->queues_[i].cancel_requested_ = false;
+    io_obj->queues_[i].linked_ = false;
+    io_obj->queues_[i].multishot_armed_ = false;
+    io_obj->queues_[i].multishot_posted_ = false;
+    io_obj->queues_[i].multishot_discard_ = 0;
+    io_obj->queues_[i].multishot_discard_context_ = 0;
   }
 }
 
@@ -221,10 +283,17 @@ void io_uring_service::register_internal_io_object(
 
   io_obj->service_ = this;
   io_obj->shutdown_ = false;
+  io_obj->descriptor_ = -1;
+  io_obj->file_index_ = -1;
   for (int i = 0; i < max_ops; ++i)
   {
     io_obj->queues_[i].io_object_ = io_obj;
     io_obj->queues_[i].cancel_requested_ = false;
+    io_obj->queues_[i].linked_ = false;
+    io_obj->queues_[i].multishot_armed_ = false;
+    io_obj->queues_[i].multishot_posted_ = false;
+    io_obj->queues_[i].multishot_discard_ = 0;
+    io_obj->queues_[i].multishot_discard_context_ = 0;
   }
 
   io_obj->queues_[op_type].op_queue_.push(op);
@@ -260,6 +329,51 @@ void io_uring_service::unregister_buffers()
   (void)::io_uring_unregister_buffers(&ring_);
 }
 
+int io_uring_service::register_buffer_ring(::io_uring_buf_ring*& ring,
+    void* data, unsigned count, std::size_t size)
+{
+  mutex::scoped_lock lock(mutex_);
+  int group_id;
+  if (!free_buffer_groups_.empty())
+  {
+    group_id = free_buffer_groups_.back();
+    free_buffer_groups_.pop_back();
+  }
+  else
+    group_id = next_buffer_group_++;
+  lock.unlock();
+
+  int result = 0;
+  ring = ::io_uring_setup_buf_ring(&ring_, count, group_id, 0, &result);
+  if (!ring)
+  {
+    lock.lock();
+    free_buffer_groups_.push_back(group_id);
+    lock.unlock();
+    boost::system::error_code ec(-result,
+        boost::asio::error::get_system_category());
+    boost::asio::detail::throw_error(ec, "io_uring_setup_buf_ring");
+  }
+
+  for (unsigned i = 0; i < count; ++i)
+  {
+    ::io_uring_buf_ring_add(ring, static_cast<char*>(data) + i * size,
+        static_cast<unsigned>(size), static_cast<unsigned short>(i),
+        ::io_uring_buf_ring_mask(count), static_cast<int>(i));
+  }
+  ::io_uring_buf_ring_advance(ring, static_cast<int>(count));
+
+  return group_id;
+}
+
+void io_uring_service::unregister_buffer_ring(
+    ::io_uring_buf_ring* ring, unsigned count, int group_id)
+{
+  (void)::io_uring_free_buf_ring(&ring_, ring, count, group_id);
+  mutex::scoped_lock lock(mutex_);
+  free_buffer_groups_.push_back(group_id);
+}
+
 void io_uring_service::start_op(int op_type,
     io_uring_service::per_io_object_data& io_obj,
     io_uring_operation* op, bool is_continuation)
@@ -295,6 +409,7 @@ void io_uring_service::start_op(int op_type,
       if (::io_uring_sqe* sqe = get_sqe())
       {
         op->prepare(sqe);
+        use_fixed_file(io_obj, sqe);
         ::io_uring_sqe_set_data(sqe, &io_obj->queues_[op_type]);
         scheduler_.work_started();
         post_submit_sqes_op(lock);
@@ -302,7 +417,7 @@ void io_uring_service::start_op(int op_type,
       else
       {
         lock.unlock();
-        io_obj->queues_[op_type].set_result(-ENOBUFS);
+        io_obj->queues_[op_type].set_result(-ENOBUFS, 0);
         post_immediate_completion(&io_obj->queues_[op_type], is_continuation);
       }
     }
@@ -314,6 +429,124 @@ void io_uring_service::start_op(int op_type,
   }
 }
 
+void io_uring_service::start_linked_ops(
+    io_uring_service::per_io_object_data& io_obj,
+    int op_type1, io_uring_operation* op1,
+    int op_type2, io_uring_operation* op2, bool is_continuation)
+{
+  if (!io_obj)
+  {
+    start_op(op_type1, io_obj, op1, is_continuation);
+    start_op(op_type2, io_obj, op2, is_continuation);
+    return;
+  }
+
+  mutex::scoped_lock io_object_lock(io_obj->mutex_);
+
+  if (!io_obj->shutdown_
+      && io_obj->queues_[op_type1].op_queue_.empty()
+      && io_obj->queues_[op_type2].op_queue_.empty())
+  {
+    mutex::scoped_lock lock(mutex_);
+
+    // Both entries must be placed in the same submission for the link to take
+    // effect, so make room for them if necessary.
+    if (::io_uring_sq_space_left(&ring_) < 2)
+      submit_sqes();
+
+    if (::io_uring_sq_space_left(&ring_) >= 2)
+    {
+      io_obj->queues_[op_type1].op_queue_.push(op1);
+      io_obj->queues_[op_type2].op_queue_.push(op2);
+      io_obj->queues_[op_type2].linked_ = true;
+
+      ::io_uring_sqe* sqe = get_sqe();
+      op1->prepare(sqe);
+      use_fixed_file(io_obj, sqe);
+      sqe->flags |= IOSQE_IO_LINK;
+      ::io_uring_sqe_set_data(sqe, &io_obj->queues_[op_type1]);
+
+      sqe = get_sqe();
+      op2->prepare(sqe);
+      use_fixed_file(io_obj, sqe);
+      ::io_uring_sqe_set_data(sqe, &io_obj->queues_[op_type2]);
+
+      scheduler_.work_started();
+      scheduler_.work_started();
+      io_object_lock.unlock();
+      post_submit_sqes_op(lock);
+      return;
+    }
+  }
+
+  io_object_lock.unlock();
+  start_op(op_type1, io_obj, op1, is_continuation);
+  start_op(op_type2, io_obj, op2, is_continuation);
+}
+
+void io_uring_service::start_multishot_op(
+    io_uring_service::per_io_object_data& io_obj, io_uring_operation* op,
+    multishot_discard_func_type discard, void* discard_context,
+    bool is_continuation)
+{
+  if (!io_obj)
+  {
+    op->ec_ = boost::asio::error::bad_descriptor;
+    post_immediate_completion(op, is_continuation);
+    return;
+  }
+
+  mutex::scoped_lock io_object_lock(io_obj->mutex_);
+
+  if (io_obj->shutdown_)
+  {
+    io_object_lock.unlock();
+    post_immediate_completion(op, is_continuation);
+    return;
+  }
+
+  io_queue& io_q = io_obj->queues_[multishot_op];
+
+  // Retained results can only be consumed by operations that share the
+  // context used to produce them.
+  if (io_q.multishot_discard_context_ != discard_context
+      && (io_q.multishot_armed_ || io_q.multishot_posted_
+        || io_q.multishot_head_ != io_q.multishot_results_.size()))
+  {
+    io_object_lock.unlock();
+    op->ec_ = boost::asio::error::invalid_argument;
+    post_immediate_completion(op, is_continuation);
+    return;
+  }
+
+  io_q.multishot_discard_ = discard;
+  io_q.multishot_discard_context_ = discard_context;
+
+  // Complete the operation immediately if a result has already been received.
+  if (io_q.op_queue_.empty() && io_q.pop_multishot_result(op))
+  {
+    op->perform(true);
+    io_object_lock.unlock();
+    scheduler_.post_immediate_completion(op, is_continuation);
+    return;
+  }
+
+  // Otherwise wait for the next result, arming the multishot submission queue
+  // entry if it is not already active or about to be rearmed.
+  io_q.op_queue_.push(op);
+  if (io_q.multishot_armed_ || io_q.multishot_posted_ || arm_multishot_op(io_q))
+  {
+    scheduler_.work_started();
+  }
+  else
+  {
+    io_q.op_queue_.pop();
+    io_object_lock.unlock();
+    op->ec_ = boost::asio::error::no_buffer_space;
+    post_immediate_completion(op, is_continuation);
+  }
+}
+
 void io_uring_service::cancel_ops(io_uring_service::per_io_object_data& io_obj)
 {
   if (!io_obj)
@@ -343,7 +576,15 @@ void io_uring_service::cancel_ops_by_key(
     io_obj->queues_[op_type].op_queue_.pop();
     if (op->cancellation_key_ == cancellation_key)
     {
-      if (first)
+      if (first && op_type == multishot_op
+          && !io_obj->queues_[op_type].multishot_armed_)
+      {
+        // The multishot operation will be rearmed for the next waiting
+        // operation, so there is nothing to cancel in the kernel.
+        op->ec_ = boost::asio::error::operation_aborted;
+        ops.push(op);
+      }
+      else if (first)
       {
         other_ops.push(op);
         if (!io_obj->queues_[op_type].cancel_requested_)
@@ -385,7 +626,9 @@ void io_uring_service::deregister_io_object(
   {
     op_queue<operation> ops;
     bool pending_cancelled_ops = do_cancel_ops(io_obj, ops);
+    io_obj->queues_[multishot_op].discard_multishot_results();
     io_obj->shutdown_ = true;
+    unregister_file(io_obj);
     io_object_lock.unlock();
     scheduler_.post_deferred_completions(ops);
     if (pending_cancelled_ops)
@@ -420,6 +663,9 @@ void io_uring_service::cleanup_io_object(
 
 void io_uring_service::run(long usec, op_queue<operation>& ops)
 {
+  if (single_issuer_)
+    submit_as_issuer();
+
   __kernel_timespec ts;
   int local_ops = 0;
 
@@ -458,7 +704,10 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
   }
 
   bool check_timers = false;
+  bool timeout_updated = false;
+  int timeout_update_result = 0;
   int count = 0;
+  int finished = 0;
   while (result == 0 || local_ops > 0)
   {
     if (result == 0)
@@ -479,6 +728,12 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
           timeout_.tv_sec = 0;
           timeout_.tv_nsec = 0;
         }
+        else if (ptr == &timeout_update_)
+        {
+          check_timers = true;
+          timeout_updated = true;
+          timeout_update_result = cqe->res;
+        }
         else if (ptr == &ts)
         {
           --local_ops;
@@ -486,10 +741,27 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
         else
         {
           io_queue* io_q = static_cast<io_queue*>(ptr);
-          io_q->set_result(cqe->res);
-          ops.push(io_q);
+          if (io_q == &io_q->io_object_->queues_[multishot_op])
+          {
+            if (io_q->push_multishot_result(cqe->res, cqe->flags))
+              ops.push(io_q);
+          }
+          else if ((cqe->flags & IORING_CQE_F_NOTIF) != 0)
+          {
+            // The buffers of a zero-copy send have been released, so the
+            // result saved from the send's first completion is delivered.
+            ops.push(io_q);
+          }
+          else
+          {
+            io_q->set_result(cqe->res, cqe->flags);
+            if (is_final_cqe(cqe))
+              ops.push(io_q);
+          }
         }
       }
+      if (is_final_cqe(cqe))
+        ++finished;
       ::io_uring_cqe_seen(&ring_, cqe);
       ++count;
     }
@@ -497,15 +769,27 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
       ? ::io_uring_peek_cqe(&ring_, &cqe) : -EAGAIN;
   }
 
-  decrement(outstanding_work_, count);
+  decrement(outstanding_work_, finished);
 
   if (check_timers)
   {
     mutex::scoped_lock lock(mutex_);
     timer_queues_.get_ready_timers(ops);
-    if (timeout_.tv_sec == 0 && timeout_.tv_nsec == 0)
+    if (timeout_updated)
+    {
+      timeout_update_pending_ = false;
+      if (timeout_update_result == -EINVAL)
+        timeout_update_supported_ = false;
+    }
+    if (timeout_update_pending_)
+    {
+      // The timeout is not restarted until the outstanding update completes,
+      // as the update would otherwise apply to the restarted timeout.
+    }
+    else if (timeout_.tv_sec == 0 && timeout_.tv_nsec == 0)
     {
       timeout_ = get_timeout();
+      timeout_expiry_ = get_timeout_expiry(timeout_);
       if (::io_uring_sqe* sqe = get_sqe())
       {
         ::io_uring_prep_timeout(sqe, &timeout_, 0, 0);
@@ -513,11 +797,27 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
         push_submit_sqes_op(ops);
       }
     }
+    else if (timeout_updated && timeout_update_result != -ENOENT)
+    {
+      // Apply any changes to the earliest timer that were made while the
+      // update was outstanding. If the update found no pending timeout then
+      // the timeout has already expired, and is restarted when its completion
+      // is received.
+      update_timeout();
+      push_submit_sqes_op(ops);
+    }
   }
 }
 
 void io_uring_service::interrupt()
 {
+  if (single_issuer_)
+  {
+    // Only the issuing thread may submit a nop to interrupt itself.
+    signal_event_fd();
+    return;
+  }
+
   mutex::scoped_lock lock(mutex_);
   if (::io_uring_sqe* sqe = get_sqe())
   {
@@ -529,7 +829,51 @@ void io_uring_service::interrupt()
 
 void io_uring_service::init_ring()
 {
-  int result = ::io_uring_queue_init(ring_size, &ring_, 0);
+  // Single issuer rings are only supported when the io_uring service is the
+  // scheduler's task, as only then is the ring run by the issuing thread.
+  unsigned int supported_flags = IORING_SETUP_SQPOLL;
+  unsigned int task_run_flags = IORING_SETUP_COOP_TASKRUN;
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+# if defined(IORING_SETUP_SINGLE_ISSUER)
+  supported_flags |= IORING_SETUP_SINGLE_ISSUER;
+# endif // defined(IORING_SETUP_SINGLE_ISSUER)
+# if defined(IORING_SETUP_DEFER_TASKRUN)
+  task_run_flags |= IORING_SETUP_DEFER_TASKRUN;
+# endif // defined(IORING_SETUP_DEFER_TASKRUN)
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  supported_flags |= task_run_flags;
+  if ((setup_flags_ & ~supported_flags) != 0)
+  {
+    ring_.ring_fd = -1;
+    boost::asio::detail::throw_error(
+        boost::asio::error::invalid_argument, "io_uring_queue_init");
+  }
+
+  ::io_uring_params params = ::io_uring_params();
+  params.flags = setup_flags_;
+  if ((setup_flags_ & IORING_SETUP_SQPOLL) != 0)
+  {
+    params.sq_thread_idle = sqpoll_idle_;
+    if (sqpoll_cpu_ >= 0)
+    {
+      params.flags |= IORING_SETUP_SQ_AFF;
+      params.sq_thread_cpu = static_cast<unsigned int>(sqpoll_cpu_);
+    }
+  }
+  if ((setup_flags_ & task_run_flags) != 0)
+  {
+    // Pending task work is flagged so that a non-blocking check for
+    // completions enters the kernel to run it.
+    params.flags |= IORING_SETUP_TASKRUN_FLAG;
+  }
+  if (single_issuer_)
+  {
+    // The thread that first runs the ring becomes its issuer.
+    params.flags |= IORING_SETUP_R_DISABLED;
+    ring_enabled_ = false;
+  }
+
+  int result = ::io_uring_queue_init_params(ring_size, &ring_, &params);
   if (result < 0)
   {
     ring_.ring_fd = -1;
@@ -538,6 +882,37 @@ void io_uring_service::init_ring()
     boost::asio::detail::throw_error(ec, "io_uring_queue_init");
   }
 
+  if (!registered_files_.empty())
+  {
+    result = ::io_uring_register_files(&ring_, &registered_files_[0],
+        static_cast<unsigned>(registered_files_.size()));
+    if (result < 0)
+    {
+      ::io_uring_queue_exit(&ring_);
+      ring_.ring_fd = -1;
+      boost::system::error_code ec(-result,
+          boost::asio::error::get_system_category());
+      boost::asio::detail::throw_error(ec, "io_uring_register_files");
+    }
+  }
+
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  if (single_issuer_)
+  {
+    if (event_fd_ != -1)
+      ::close(event_fd_);
+    event_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (event_fd_ < 0)
+    {
+      boost::system::error_code ec(errno,
+          boost::asio::error::get_system_category());
+      ::io_uring_queue_exit(&ring_);
+      ring_.ring_fd = -1;
+      boost::asio::detail::throw_error(ec, "eventfd");
+    }
+  }
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+
 #if !defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
   event_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
   if (event_fd_ < 0)
@@ -603,6 +978,57 @@ public:
     delete o;
   }
 
+private:
+  io_uring_service* service_;
+};
+#else // !defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+class io_uring_service::event_fd_read_op :
+  public io_uring_operation
+{
+public:
+  event_fd_read_op(io_uring_service* s)
+    : io_uring_operation(boost::system::error_code(),
+        &event_fd_read_op::do_prepare, &event_fd_read_op::do_perform,
+        event_fd_read_op::do_complete),
+      service_(s)
+  {
+  }
+
+  static void do_prepare(io_uring_operation* base, ::io_uring_sqe* sqe)
+  {
+    event_fd_read_op* o(static_cast<event_fd_read_op*>(base));
+
+    ::io_uring_prep_poll_add(sqe, o->service_->event_fd_, POLLIN);
+  }
+
+  static bool do_perform(io_uring_operation* base, bool)
+  {
+    event_fd_read_op* o(static_cast<event_fd_read_op*>(base));
+
+    for (;;)
+    {
+      // Only perform one read. The kernel maintains an atomic counter.
+      uint64_t counter(0);
+      errno = 0;
+      int bytes_read = ::read(o->service_->event_fd_,
+          &counter, sizeof(uint64_t));
+      if (bytes_read < 0 && errno == EINTR)
+        continue;
+      break;
+    }
+
+    // The operation is never complete, so that the poll is rearmed.
+    return false;
+  }
+
+  static void do_complete(void* /*owner*/, operation* base,
+      const boost::system::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    event_fd_read_op* o(static_cast<event_fd_read_op*>(base));
+    delete o;
+  }
+
 private:
   io_uring_service* service_;
 };
@@ -613,9 +1039,35 @@ void io_uring_service::register_with_reactor()
 #if !defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
   reactor_.register_internal_descriptor(reactor::read_op,
       event_fd_, reactor_data_, new event_fd_read_op(this));
+#else // !defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  // A single issuer ring waits on the eventfd itself. The operation is
+  // restarted automatically following a fork.
+  if (single_issuer_ && !event_fd_io_object_)
+  {
+    register_internal_io_object(event_fd_io_object_,
+        read_op, new event_fd_read_op(this));
+  }
 #endif // !defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
 }
 
+void io_uring_service::signal_event_fd()
+{
+  uint64_t counter(1);
+  int result = ::write(event_fd_, &counter, sizeof(uint64_t));
+  (void)result;
+}
+
+void io_uring_service::submit_as_issuer()
+{
+  mutex::scoped_lock lock(mutex_);
+  if (!ring_enabled_)
+  {
+    ::io_uring_enable_rings(&ring_);
+    ring_enabled_ = true;
+  }
+  submit_sqes();
+}
+
 io_uring_service::io_object* io_uring_service::allocate_io_object()
 {
   mutex::scoped_lock registration_lock(registration_mutex_);
@@ -624,10 +1076,68 @@ io_uring_service::io_object* io_uring_service::allocate_io_object()
 
 void io_uring_service::free_io_object(io_uring_service::io_object* io_obj)
 {
+  if (io_obj->file_index_ >= 0)
+  {
+    // No further completions can refer to the fixed file table entry.
+    mutex::scoped_lock lock(mutex_);
+    free_files_.push_back(io_obj->file_index_);
+    io_obj->file_index_ = -1;
+  }
+
   mutex::scoped_lock registration_lock(registration_mutex_);
   registered_io_objects_.free(io_obj);
 }
 
+int io_uring_service::register_file(int descriptor)
+{
+  if (descriptor < 0)
+    return -1;
+
+  mutex::scoped_lock lock(mutex_);
+  if (free_files_.empty())
+    return -1;
+
+  int index = free_files_.back();
+  int result = ::io_uring_register_files_update(&ring_,
+      static_cast<unsigned>(index), &descriptor, 1);
+  if (result < 0)
+    return -1;
+
+  free_files_.pop_back();
+  registered_files_[index] = descriptor;
+  return index;
+}
+
+void io_uring_service::unregister_file(io_uring_service::io_object* io_obj)
+{
+  if (io_obj->file_index_ < 0 || io_obj->descriptor_ < 0)
+    return;
+
+  // Pending submission queue entries may refer to the entry, so they must be
+  // consumed by the kernel before the entry is cleared. The entry must also be
+  // cleared before the descriptor is closed, as the table holds a reference to
+  // the open file.
+  mutex::scoped_lock lock(mutex_);
+  submit_sqes();
+  if ((setup_flags_ & IORING_SETUP_SQPOLL) != 0)
+  {
+    // Submitting only makes the entries visible to the polling thread, which
+    // consumes them asynchronously. Wait until the submission queue head has
+    // moved past them.
+    while (::io_uring_sq_ready(&ring_) != 0)
+    {
+      if (::io_uring_submit(&ring_) < 0)
+        break;
+      ::sched_yield();
+    }
+  }
+  int descriptor = -1;
+  (void)::io_uring_register_files_update(&ring_,
+      static_cast<unsigned>(io_obj->file_index_), &descriptor, 1);
+  registered_files_[io_obj->file_index_] = -1;
+  io_obj->descriptor_ = -1;
+}
+
 bool io_uring_service::do_cancel_ops(
     per_io_object_data& io_obj, op_queue<operation>& ops)
 {
@@ -637,7 +1147,6 @@ bool io_uring_service::do_cancel_ops(
   {
     if (io_uring_operation* first_op = io_obj->queues_[i].op_queue_.front())
     {
-      cancel_op = true;
       io_obj->queues_[i].op_queue_.pop();
       while (io_uring_operation* op = io_obj->queues_[i].op_queue_.front())
       {
@@ -645,8 +1154,22 @@ bool io_uring_service::do_cancel_ops(
         io_obj->queues_[i].op_queue_.pop();
         ops.push(op);
       }
-      io_obj->queues_[i].op_queue_.push(first_op);
+      if (i != multishot_op || io_obj->queues_[i].multishot_armed_)
+      {
+        cancel_op = true;
+        io_obj->queues_[i].op_queue_.push(first_op);
+      }
+      else
+      {
+        // The multishot operation is not active, so there is nothing to
+        // cancel in the kernel.
+        first_op->ec_ = boost::asio::error::operation_aborted;
+        ops.push(first_op);
+      }
     }
+
+    if (io_obj->queues_[i].multishot_armed_)
+      cancel_op = true;
   }
 
   if (cancel_op)
@@ -654,7 +1177,8 @@ bool io_uring_service::do_cancel_ops(
     mutex::scoped_lock lock(mutex_);
     for (int i = 0; i < max_ops; ++i)
     {
-      if (!io_obj->queues_[i].op_queue_.empty()
+      if ((!io_obj->queues_[i].op_queue_.empty()
+            || io_obj->queues_[i].multishot_armed_)
           && !io_obj->queues_[i].cancel_requested_)
       {
         io_obj->queues_[i].cancel_requested_ = true;
@@ -668,6 +1192,21 @@ bool io_uring_service::do_cancel_ops(
   return cancel_op;
 }
 
+bool io_uring_service::arm_multishot_op(io_queue& io_q)
+{
+  mutex::scoped_lock lock(mutex_);
+  if (::io_uring_sqe* sqe = get_sqe())
+  {
+    io_q.op_queue_.front()->prepare(sqe);
+    use_fixed_file(io_q.io_object_, sqe);
+    ::io_uring_sqe_set_data(sqe, &io_q);
+    io_q.multishot_armed_ = true;
+    post_submit_sqes_op(lock);
+    return true;
+  }
+  return false;
+}
+
 void io_uring_service::do_add_timer_queue(timer_queue_base& queue)
 {
   mutex::scoped_lock lock(mutex_);
@@ -682,7 +1221,32 @@ void io_uring_service::do_remove_timer_queue(timer_queue_base& queue)
 
 void io_uring_service::update_timeout()
 {
-  if (::io_uring_sqe* sqe = get_sqe())
+  // Only one update is outstanding at a time. Changes made in the meantime
+  // are applied once it completes.
+  if (timeout_update_pending_)
+    return;
+
+  if (timeout_update_supported_
+      && (timeout_.tv_sec != 0 || timeout_.tv_nsec != 0))
+  {
+    // There is nothing to do if the pending timeout expires no later than
+    // the earliest timer.
+    __kernel_timespec ts = get_timeout();
+    long long expiry = get_timeout_expiry(ts);
+    if (expiry >= timeout_expiry_)
+      return;
+
+    if (::io_uring_sqe* sqe = get_sqe())
+    {
+      timeout_update_ = ts;
+      timeout_expiry_ = expiry;
+      timeout_update_pending_ = true;
+      ::io_uring_prep_timeout_update(sqe, &timeout_update_,
+          reinterpret_cast<__u64>(&timeout_), 0);
+      ::io_uring_sqe_set_data(sqe, &timeout_update_);
+    }
+  }
+  else if (::io_uring_sqe* sqe = get_sqe())
   {
     ::io_uring_prep_timeout_remove(sqe, reinterpret_cast<__u64>(&timeout_), 0);
     ::io_uring_sqe_set_data(sqe, &timer_queues_);
@@ -698,6 +1262,14 @@ __kernel_timespec io_uring_service::get_timeout() const
   return ts;
 }
 
+long long io_uring_service::get_timeout_expiry(const __kernel_timespec& ts)
+{
+  timespec now;
+  ::clock_gettime(CLOCK_MONOTONIC, &now);
+  return (static_cast<long long>(now.tv_sec) + ts.tv_sec) * 1000000
+    + (now.tv_nsec + ts.tv_nsec) / 1000;
+}
+
 ::io_uring_sqe* io_uring_service::get_sqe()
 {
   ::io_uring_sqe* sqe = ::io_uring_get_sqe(&ring_);
@@ -705,6 +1277,12 @@ __kernel_timespec io_uring_service::get_timeout() const
   {
     submit_sqes();
     sqe = ::io_uring_get_sqe(&ring_);
+    if (!sqe && (setup_flags_ & IORING_SETUP_SQPOLL) != 0)
+    {
+      // Wait for the polling thread to consume submitted entries.
+      ::io_uring_sqring_wait(&ring_);
+      sqe = ::io_uring_get_sqe(&ring_);
+    }
   }
   if (sqe)
   {
@@ -724,13 +1302,21 @@ void io_uring_service::submit_sqes()
       pending_sqes_ -= result;
       increment(outstanding_work_, result);
     }
+    else if (result == -EEXIST && single_issuer_)
+    {
+      // The entries remain queued until the issuing thread submits them.
+      signal_event_fd();
+    }
   }
 }
 
 void io_uring_service::post_submit_sqes_op(mutex::scoped_lock& lock)
 {
-  if (pending_sqes_ >= submit_batch_size)
+  if (pending_sqes_ >= submit_batch_size
+      || (setup_flags_ & IORING_SETUP_SQPOLL) != 0)
   {
+    // With a submission queue polling thread, submitting only requires a
+    // system call if the thread must be woken.
     submit_sqes();
   }
   else if (pending_sqes_ != 0 && !pending_submit_sqes_op_)
@@ -773,8 +1359,114 @@ void io_uring_service::submit_sqes_op::do_complete(void* owner, operation* base,
 }
 
 io_uring_service::io_queue::io_queue()
-  : operation(&io_uring_service::io_queue::do_complete)
+  : operation(&io_uring_service::io_queue::do_complete),
+    cancel_requested_(false),
+    linked_(false),
+    cqe_flags_(0),
+    multishot_armed_(false),
+    multishot_posted_(false),
+    multishot_head_(0),
+    multishot_discard_(0),
+    multishot_discard_context_(0)
+{
+}
+
+bool io_uring_service::io_queue::push_multishot_result(
+    int result, unsigned flags)
+{
+  mutex::scoped_lock io_object_lock(io_object_->mutex_);
+
+  bool final_cqe = (flags & IORING_CQE_F_MORE) == 0;
+  if (final_cqe)
+    multishot_armed_ = false;
+
+  if (result >= 0 && io_object_->shutdown_)
+  {
+    // The I/O object has been closed, so no operation will consume the result.
+    if (multishot_discard_)
+      multishot_discard_(multishot_discard_context_, result, flags);
+  }
+  else if (result != -ECANCELED)
+  {
+    multishot_result r = { result, flags };
+    multishot_results_.push_back(r);
+  }
+  else if (cancel_requested_ && !op_queue_.empty())
+  {
+    // Only a cancellation requested by the user is reported, and only to an
+    // operation that is waiting. Other cancellations are used internally to
+    // apply backpressure or to prepare for a fork.
+    multishot_result r = { result, flags };
+    multishot_results_.push_back(r);
+  }
+
+  if (final_cqe)
+    cancel_requested_ = false;
+
+  std::size_t backlog = multishot_results_.size() - multishot_head_;
+  if (backlog == multishot_backlog_limit && multishot_armed_)
+  {
+    // Too many results are waiting to be consumed. Stop the multishot
+    // operation until the backlog has been drained.
+    io_uring_service* service = io_object_->service_;
+    mutex::scoped_lock lock(service->mutex_);
+    if (::io_uring_sqe* sqe = service->get_sqe())
+    {
+      ::io_uring_prep_cancel(sqe, this, 0);
+      service->submit_sqes();
+    }
+  }
+
+  // The queue needs to be processed if there are results for waiting
+  // operations, if the multishot operation must be rearmed, or if this was
+  // the last outstanding completion for a closed I/O object.
+  bool process = (!op_queue_.empty() && (backlog > 0 || final_cqe))
+    || (final_cqe && io_object_->shutdown_);
+  if (process && !multishot_posted_)
+  {
+    multishot_posted_ = true;
+    return true;
+  }
+  return false;
+}
+
+bool io_uring_service::io_queue::pop_multishot_result(io_uring_operation* op)
 {
+  if (multishot_head_ == multishot_results_.size())
+    return false;
+
+  const multishot_result& r = multishot_results_[multishot_head_++];
+  if (r.result_ < 0)
+  {
+    op->ec_.assign(-r.result_, boost::asio::error::get_system_category());
+    op->bytes_transferred_ = 0;
+  }
+  else
+  {
+    op->ec_.assign(0, op->ec_.category());
+    op->bytes_transferred_ = static_cast<std::size_t>(r.result_);
+  }
+  op->cqe_flags_ = r.flags_;
+
+  if (multishot_head_ == multishot_results_.size())
+  {
+    multishot_results_.clear();
+    multishot_head_ = 0;
+  }
+
+  return true;
+}
+
+void io_uring_service::io_queue::discard_multishot_results()
+{
+  for (std::size_t i = multishot_head_; i < multishot_results_.size(); ++i)
+  {
+    const multishot_result& r = multishot_results_[i];
+    if (r.result_ >= 0 && multishot_discard_)
+      multishot_discard_(multishot_discard_context_, r.result_, r.flags_);
+  }
+  multishot_results_.clear();
+  multishot_head_ = 0;
 }
 
 struct io_uring_service::perform_io_cleanup_on_block_exit
@@ -822,7 +1514,9 @@ operation* io_uring_service::io_queue::perform_io(int result)
   perform_io_cleanup_on_block_exit io_cleanup(io_object_->service_);
   mutex::scoped_lock io_object_lock(io_object_->mutex_);
 
-  if (result != -ECANCELED || cancel_requested_)
+  // A linked operation that is cancelled because the preceding operation in
+  // its chain failed is completed, rather than restarted.
+  if (result != -ECANCELED || cancel_requested_ || linked_)
   {
     if (io_uring_operation* op = op_queue_.front())
     {
@@ -836,6 +1530,7 @@ operation* io_uring_service::io_queue::perform_io(int result)
         op->ec_.assign(0, op->ec_.category());
         op->bytes_transferred_ = static_cast<std::size_t>(result);
       }
+      op->cqe_flags_ = cqe_flags_;
     }
 
     while (io_uring_operation* op = op_queue_.front())
@@ -851,6 +1546,7 @@ operation* io_uring_service::io_queue::perform_io(int result)
   }
 
   cancel_requested_ = false;
+  linked_ = false;
 
   if (!op_queue_.empty())
   {
@@ -859,6 +1555,7 @@ operation* io_uring_service::io_queue::perform_io(int result)
     if (::io_uring_sqe* sqe = service->get_sqe())
     {
       op_queue_.front()->prepare(sqe);
+      service->use_fixed_file(io_object_, sqe);
       ::io_uring_sqe_set_data(sqe, this);
       service->post_submit_sqes_op(lock);
     }
@@ -879,7 +1576,82 @@ operation* io_uring_service::io_queue::perform_io(int result)
   {
     io_cleanup.io_object_to_free_ = io_object_;
     for (int i = 0; i < max_ops; ++i)
-      if (!io_object_->queues_[i].op_queue_.empty())
+      if (!io_object_->queues_[i].op_queue_.empty()
+          || io_object_->queues_[i].multishot_armed_
+          || io_object_->queues_[i].multishot_posted_)
+        io_cleanup.io_object_to_free_ = 0;
+  }
+
+  // The first operation will be returned for completion now. The others will
+  // be posted for later by the io_cleanup object's destructor.
+  io_cleanup.first_op_ = io_cleanup.ops_.front();
+  io_cleanup.ops_.pop();
+  return io_cleanup.first_op_;
+}
+
+operation* io_uring_service::io_queue::perform_multishot_io()
+{
+  perform_io_cleanup_on_block_exit io_cleanup(io_object_->service_);
+  mutex::scoped_lock io_object_lock(io_object_->mutex_);
+
+  multishot_posted_ = false;
+
+  // Complete waiting operations using the results received so far. A
+  // multishot operation always completes once it has been given a result.
+  while (io_uring_operation* op = op_queue_.front())
+  {
+    if (!pop_multishot_result(op))
+      break;
+    op->perform(true);
+    op_queue_.pop();
+    io_cleanup.ops_.push(op);
+  }
+
+  // A user-requested cancellation is not reported to later operations.
+  if (op_queue_.empty() && multishot_head_ != multishot_results_.size()
+      && multishot_results_.back().result_ == -ECANCELED)
+  {
+    multishot_results_.pop_back();
+    if (multishot_head_ == multishot_results_.size())
+    {
+      multishot_results_.clear();
+      multishot_head_ = 0;
+    }
+  }
+
+  // Rearm the multishot operation if there are still operations waiting.
+  if (!op_queue_.empty() && !multishot_armed_ && !io_object_->shutdown_)
+  {
+    if (!io_object_->service_->arm_multishot_op(*this))
+    {
+      while (io_uring_operation* op = op_queue_.front())
+      {
+        op->ec_ = boost::asio::error::no_buffer_space;
+        op_queue_.pop();
+        io_cleanup.ops_.push(op);
+      }
+    }
+  }
+
+  // The last operation to complete on a shut down object must free it.
+  if (io_object_->shutdown_)
+  {
+    if (!multishot_armed_)
+    {
+      while (io_uring_operation* op = op_queue_.front())
+      {
+        op->ec_ = boost::asio::error::operation_aborted;
+        op_queue_.pop();
+        io_cleanup.ops_.push(op);
+      }
+    }
+
+    discard_multishot_results();
+    io_cleanup.io_object_to_free_ = io_object_;
+    for (int i = 0; i < max_ops; ++i)
+      if (!io_object_->queues_[i].op_queue_.empty()
+          || io_object_->queues_[i].multishot_armed_
+          || io_object_->queues_[i].multishot_posted_)
         io_cleanup.io_object_to_free_ = 0;
   }
 
@@ -897,7 +1669,9 @@ void io_uring_service::io_queue::do_complete(void* owner, operation* base,
   {
     io_queue* io_q = static_cast<io_queue*>(base);
     int result = static_cast<int>(bytes_transferred);
-    if (operation* op = io_q->perform_io(result))
+    operation* op = (io_q == &io_q->io_object_->queues_[multishot_op])
+      ? io_q->perform_multishot_io() : io_q->perform_io(result);
+    if (op)
     {
       op->complete(owner, ec, 0);
     }
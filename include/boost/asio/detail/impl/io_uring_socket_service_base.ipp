@@ -19,6 +19,7 @@
 
 #if defined(BOOST_ASIO_HAS_IO_URING)
 
+#include <boost/asio/config.hpp>
 #include <boost/asio/detail/io_uring_socket_service_base.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
@@ -29,7 +30,10 @@ namespace detail {
 
 io_uring_socket_service_base::io_uring_socket_service_base(
     execution_context& context)
-  : io_uring_service_(boost::asio::use_service<io_uring_service>(context))
+  : io_uring_service_(boost::asio::use_service<io_uring_service>(context)),
+    busy_poll_usec_(
+        boost::asio::config(context).get(
+          "reactor", "socket_busy_poll_usec", 0))
 {
   io_uring_service_.init_task();
 }
@@ -174,7 +178,7 @@ boost::system::error_code io_uring_socket_service_base::do_open(
   if (sock.get() == invalid_socket)
     return ec;
 
-  io_uring_service_.register_io_object(impl.io_object_data_);
+  io_uring_service_.register_io_object(impl.io_object_data_, sock.get());
 
   impl.socket_ = sock.release();
   switch (type)
@@ -183,6 +187,8 @@ boost::system::error_code io_uring_socket_service_base::do_open(
   case SOCK_DGRAM: impl.state_ = socket_ops::datagram_oriented; break;
   default: impl.state_ = 0; break;
   }
+
+  socket_ops::maybe_set_busy_poll(impl.socket_, impl.state_, busy_poll_usec_);
   ec = success_ec_;
   return ec;
 }
@@ -198,7 +204,7 @@ boost::system::error_code io_uring_socket_service_base::do_assign(
     return ec;
   }
 
-  io_uring_service_.register_io_object(impl.io_object_data_);
+  io_uring_service_.register_io_object(impl.io_object_data_, native_socket);
 
   impl.socket_ = native_socket;
   switch (type)
@@ -208,6 +214,8 @@ boost::system::error_code io_uring_socket_service_base::do_assign(
   default: impl.state_ = 0; break;
   }
   impl.state_ |= socket_ops::possible_dup;
+
+  socket_ops::maybe_set_busy_poll(impl.socket_, impl.state_, busy_poll_usec_);
   ec = success_ec_;
   return ec;
 }
@@ -231,13 +239,27 @@ void io_uring_socket_service_base::start_accept_op(
     io_uring_socket_service_base::base_implementation_type& impl,
     io_uring_operation* op, bool is_continuation, bool peer_is_open)
 {
-  if (!peer_is_open)
-    start_op(impl, io_uring_service::read_op, op, is_continuation, false);
-  else
+  if (peer_is_open)
   {
     op->ec_ = boost::asio::error::already_open;
     io_uring_service_.post_immediate_completion(op, is_continuation);
   }
+  else if ((impl.state_ & socket_ops::multishot_accept) != 0)
+  {
+    io_uring_service_.start_multishot_op(impl.io_object_data_, op,
+        &io_uring_socket_service_base::discard_accepted_socket,
+        0, is_continuation);
+  }
+  else
+    start_op(impl, io_uring_service::read_op, op, is_continuation, false);
+}
+
+void io_uring_socket_service_base::discard_accepted_socket(
+    void* /*context*/, int result, unsigned /*flags*/)
+{
+  socket_ops::state_type state = 0;
+  boost::system::error_code ignored_ec;
+  socket_ops::close(result, state, true, ignored_ec);
 }
 
 } // namespace detail
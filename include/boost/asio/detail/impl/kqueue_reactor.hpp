@@ -108,6 +108,60 @@ void kqueue_reactor::move_timer(timer_queue<TimeTraits, Allocator>& queue,
   scheduler_.post_deferred_completions(ops);
 }
 
+template <typename TimeTraits, typename Allocator>
+void kqueue_reactor::reschedule_timer(
+    timer_queue<TimeTraits, Allocator>& queue,
+    const typename TimeTraits::time_type& time,
+    typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer)
+{
+  mutex::scoped_lock lock(mutex_);
+  bool earliest = queue.reschedule_timer(time, timer);
+  if (earliest)
+    interrupt();
+}
+
+template <typename TimeTraits, typename Allocator>
+void kqueue_reactor::schedule_periodic_timer(
+    timer_queue<TimeTraits, Allocator>& queue,
+    typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer,
+    typename timer_queue<TimeTraits, Allocator>::periodic_op* op)
+{
+  mutex::scoped_lock lock(mutex_);
+
+  if (shutdown_)
+  {
+    scheduler_.post_immediate_completion(op, false);
+    return;
+  }
+
+  op_queue<operation> ops;
+  bool earliest = queue.enqueue_periodic(timer, op, ops);
+  scheduler_.work_started();
+  if (earliest)
+    interrupt();
+  lock.unlock();
+  scheduler_.post_deferred_completions(ops);
+}
+
+template <typename TimeTraits, typename Allocator>
+bool kqueue_reactor::requeue_periodic_timer(
+    timer_queue<TimeTraits, Allocator>& queue,
+    typename timer_queue<TimeTraits, Allocator>::periodic_op* op)
+{
+  mutex::scoped_lock lock(mutex_);
+
+  if (shutdown_)
+    return false;
+
+  bool earliest = false;
+  queue.requeue_periodic(op, earliest);
+
+  scheduler_.work_started();
+  if (earliest)
+    interrupt();
+  return true;
+}
+
 } // namespace detail
 } // namespace asio
 } // namespace boost
@@ -59,6 +59,7 @@ kqueue_reactor::kqueue_reactor(boost::asio::execution_context& ctx)
     registered_descriptors_mutex_(mutex_.enabled()),
     registered_descriptors_(execution_context::allocator<void>(ctx),
         config(ctx).get("reactor", "preallocated_io_objects", 0U),
+        config(ctx).get("reactor", "io_object_slab_size", 1U),
         io_locking_, io_locking_spin_count_)
 {
   struct kevent events[1];
@@ -23,6 +23,7 @@
 
 #include <boost/asio/config.hpp>
 #include <boost/asio/detail/reactive_socket_service_base.hpp>
+#include <boost/asio/detail/scheduler.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
 
@@ -33,10 +34,17 @@ namespace detail {
 reactive_socket_service_base::reactive_socket_service_base(
     execution_context& context)
   : reactor_(use_service<reactor>(context)),
+    scheduler_(use_service<scheduler>(context)),
     extra_state_(
         boost::asio::config(context).get(
           "reactor", "reset_edge_on_partial_read", 0)
-        ? socket_ops::reset_edge_on_partial_read : 0)
+        ? socket_ops::reset_edge_on_partial_read : 0),
+    busy_poll_usec_(
+        boost::asio::config(context).get(
+          "reactor", "socket_busy_poll_usec", 0)),
+    inline_completion_depth_(
+        boost::asio::config(context).get(
+          "reactor", "inline_completion_depth", 0))
 {
   reactor_.init_task();
 }
@@ -210,6 +218,8 @@ boost::system::error_code reactive_socket_service_base::do_open(
     impl.state_ = 0;
     break;
   }
+
+  socket_ops::maybe_set_busy_poll(impl.socket_, impl.state_, busy_poll_usec_);
   ec = boost::system::error_code();
   return ec;
 }
@@ -247,6 +257,8 @@ boost::system::error_code reactive_socket_service_base::do_assign(
     break;
   }
   impl.state_ |= socket_ops::possible_dup;
+
+  socket_ops::maybe_set_busy_poll(impl.socket_, impl.state_, busy_poll_usec_);
   ec = boost::system::error_code();
   return ec;
 }
@@ -274,6 +286,42 @@ void reactive_socket_service_base::do_start_op(
   on_immediate(op, is_continuation, immediate_arg);
 }
 
+void reactive_socket_service_base::do_start_op_with_inline_completion(
+    reactive_socket_service_base::base_implementation_type& impl,
+    int op_type, reactor_op* op, bool is_continuation,
+    bool allow_speculative, bool noop, bool needs_non_blocking)
+{
+  deferred_immediate_completion deferred = { 0, false };
+  do_start_op(impl, op_type, op, is_continuation, allow_speculative, noop,
+      needs_non_blocking, &call_defer_immediate_completion, &deferred);
+  if (!deferred.op_)
+    return;
+
+  // Complete the operation inline only if the calling thread is running the
+  // scheduler, and only up to a bounded depth of nested completions.
+  int* depth = inline_call_stack::contains(this);
+  int next_depth = depth ? *depth + 1 : 1;
+  if (next_depth <= inline_completion_depth_ && scheduler_.can_dispatch())
+  {
+    inline_call_stack::context ctx(this, next_depth);
+    deferred.op_->complete(&scheduler_, success_ec_, 0);
+  }
+  else
+  {
+    reactor_.post_immediate_completion(
+        deferred.op_, deferred.is_continuation_);
+  }
+}
+
+void reactive_socket_service_base::call_defer_immediate_completion(
+    operation* op, bool is_continuation, const void* arg)
+{
+  deferred_immediate_completion* deferred =
+    static_cast<deferred_immediate_completion*>(const_cast<void*>(arg));
+  deferred->op_ = op;
+  deferred->is_continuation_ = is_continuation;
+}
+
 void reactive_socket_service_base::do_start_accept_op(
     reactive_socket_service_base::base_implementation_type& impl,
     reactor_op* op, bool is_continuation, bool peer_is_open,
@@ -282,6 +330,11 @@ void reactive_socket_service_base::do_start_accept_op(
 {
   if (!peer_is_open)
   {
+#if defined(BOOST_ASIO_HAS_EPOLL)
+    // An acceptor may have been assigned a socket that is already listening.
+    reactor_.register_listening_descriptor(impl.socket_, impl.reactor_data_);
+#endif // defined(BOOST_ASIO_HAS_EPOLL)
+
     do_start_op(impl, reactor::read_op, op, is_continuation,
         true, false, true, on_immediate, immediate_arg);
   }
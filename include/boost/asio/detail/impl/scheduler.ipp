@@ -18,6 +18,7 @@
 #include <boost/asio/detail/config.hpp>
 
 #include <boost/asio/config.hpp>
+#include <boost/asio/detail/chrono.hpp>
 #include <boost/asio/detail/event.hpp>
 #include <boost/asio/detail/limits.hpp>
 #include <boost/asio/detail/scheduler.hpp>
@@ -58,18 +59,22 @@ struct scheduler::task_cleanup
 {
   ~task_cleanup()
   {
-    if (this_thread_->private_outstanding_work > 0)
-    {
-      boost::asio::detail::increment(
-          scheduler_->outstanding_work_,
-          this_thread_->private_outstanding_work);
-    }
+    // Work finished by the thread and not yet counted is offset against the
+    // work started by the task.
+    long started = this_thread_->private_outstanding_work
+      - this_thread_->private_finished_work;
     this_thread_->private_outstanding_work = 0;
+    this_thread_->private_finished_work = 0;
+    if (started > 0)
+      boost::asio::detail::increment(scheduler_->outstanding_work_, started);
+    else
+      this_thread_->private_finished_work = -started;
 
     // Enqueue the completed operations and reinsert the task at the end of
     // the operation queue.
     lock_->lock();
     scheduler_->task_interrupted_ = true;
+    scheduler_->task_blocked_ = 0;
     scheduler_->op_queue_.push(this_thread_->private_op_queue);
     scheduler_->op_queue_.push(&scheduler_->task_operation_);
   }
@@ -83,23 +88,33 @@ struct scheduler::work_cleanup
 {
   ~work_cleanup()
   {
-    if (this_thread_->private_outstanding_work > 1)
-    {
-      boost::asio::detail::increment(
-          scheduler_->outstanding_work_,
-          this_thread_->private_outstanding_work - 1);
-    }
-    else if (this_thread_->private_outstanding_work < 1)
-    {
-      scheduler_->work_finished();
-    }
+    // The finished handler is offset against the work that it started. Work
+    // finished by the thread is counted privately until the thread's batch is
+    // full, or until the thread runs out of handlers.
+    long started = this_thread_->private_outstanding_work
+      - this_thread_->private_finished_work - 1;
     this_thread_->private_outstanding_work = 0;
+    this_thread_->private_finished_work = 0;
+    if (started > 0)
+      boost::asio::detail::increment(scheduler_->outstanding_work_, started);
+    else if (-started >= this_thread_->work_count_batch)
+      scheduler_->work_finished(-started);
+    else
+      this_thread_->private_finished_work = -started;
 
 #if defined(BOOST_ASIO_HAS_THREADS)
     if (!this_thread_->private_op_queue.empty())
     {
-      lock_->lock();
-      scheduler_->op_queue_.push(this_thread_->private_op_queue);
+      if (scheduler_->work_queues_)
+      {
+        scheduler_->push_work_queue(*this_thread_,
+            this_thread_->private_op_queue);
+      }
+      else
+      {
+        lock_->lock();
+        scheduler_->op_queue_.push(this_thread_->private_op_queue);
+      }
     }
 #endif // defined(BOOST_ASIO_HAS_THREADS)
   }
@@ -109,20 +124,57 @@ struct scheduler::work_cleanup
   thread_info* this_thread_;
 };
 
+struct scheduler::finished_work_cleanup
+{
+  ~finished_work_cleanup()
+  {
+    if (this_thread_->private_finished_work > 0)
+    {
+      long finished = this_thread_->private_finished_work;
+      this_thread_->private_finished_work = 0;
+      scheduler_->work_finished(finished);
+    }
+  }
+
+  scheduler* scheduler_;
+  thread_info* this_thread_;
+};
+
 scheduler::scheduler(boost::asio::execution_context& ctx,
     bool own_thread, get_task_func_type get_task)
   : boost::asio::detail::execution_context_service_base<scheduler>(ctx),
     one_thread_(config(ctx).get("scheduler", "concurrency_hint", 0) == 1),
+    get_task_(get_task),
+    task_usec_(config(ctx).get("scheduler", "task_usec", -1L)),
+    wait_usec_(config(ctx).get("scheduler", "wait_usec", -1L)),
+    busy_poll_usec_(config(ctx).get("scheduler", "busy_poll_usec", 0L)),
+#if defined(BOOST_ASIO_HAS_THREADS)
+    num_work_queues_(one_thread_
+        || !config(ctx).get("scheduler", "locking", true) ? 0
+        : config(ctx).get("scheduler", "work_stealing_queues", 0U)),
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    num_work_queues_(0),
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+    work_queues_(num_work_queues_ ? new work_queue[num_work_queues_] : 0),
+#if defined(BOOST_ASIO_HAS_THREADS)
+    use_injection_queue_(config(ctx).get("scheduler", "locking", true)
+        && config(ctx).get("scheduler", "injection_queue", false)),
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    use_injection_queue_(false),
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+    use_handler_arena_(config(ctx).get("scheduler", "handler_arena", false)),
+    work_count_batch_(config(ctx).get("scheduler", "work_count_batch", 1L)),
     mutex_(config(ctx).get("scheduler", "locking", true),
         config(ctx).get("scheduler", "locking_spin_count", 0)),
     task_(0),
-    get_task_(get_task),
     task_interrupted_(true),
     stopped_(false),
     shutdown_(false),
+    busy_poll_budget_usec_(busy_poll_usec_),
     outstanding_work_(0),
-    task_usec_(config(ctx).get("scheduler", "task_usec", -1L)),
-    wait_usec_(config(ctx).get("scheduler", "wait_usec", -1L)),
+    next_work_queue_(0),
+    idle_threads_(0),
+    task_blocked_(0),
     thread_()
 {
   BOOST_ASIO_HANDLER_TRACKING_INIT;
@@ -138,15 +190,25 @@ scheduler::scheduler(boost::asio::execution_context& ctx,
 scheduler::scheduler(scheduler::internal, boost::asio::execution_context& ctx)
   : boost::asio::detail::execution_context_service_base<scheduler>(ctx),
     one_thread_(false),
+    get_task_(&scheduler::get_default_task),
+    task_usec_(-1L),
+    wait_usec_(-1L),
+    busy_poll_usec_(0),
+    num_work_queues_(0),
+    work_queues_(0),
+    use_injection_queue_(false),
+    use_handler_arena_(false),
+    work_count_batch_(1),
     mutex_(true, 0),
     task_(0),
-    get_task_(&scheduler::get_default_task),
     task_interrupted_(true),
     stopped_(false),
     shutdown_(false),
+    busy_poll_budget_usec_(0),
     outstanding_work_(0),
-    task_usec_(-1L),
-    wait_usec_(-1L)
+    next_work_queue_(0),
+    idle_threads_(0),
+    task_blocked_(0)
 {
   BOOST_ASIO_HANDLER_TRACKING_INIT;
 }
@@ -161,6 +223,8 @@ scheduler::~scheduler()
     lock.unlock();
     thread_.join();
   }
+
+  delete[] work_queues_;
 }
 
 void scheduler::shutdown()
@@ -175,6 +239,8 @@ void scheduler::shutdown()
   thread_.join();
 
   // Destroy handler objects.
+  flush_work_queues();
+  injection_queue_.pop_all(op_queue_);
   while (!op_queue_.empty())
   {
     operation* o = op_queue_.front();
@@ -208,12 +274,29 @@ std::size_t scheduler::run(boost::system::error_code& ec)
   }
 
   thread_info this_thread;
-  this_thread.private_outstanding_work = 0;
+  init_thread_info(this_thread);
+  if (use_handler_arena_)
+    this_thread.enable_handler_arena();
+  if (work_count_batch_ > 1)
+    this_thread.work_count_batch = work_count_batch_;
   thread_call_stack::context ctx(this, this_thread);
 
+  // Ensure that work finished by this thread is counted on exit.
+  finished_work_cleanup on_exit = { this, &this_thread };
+  (void)on_exit;
+
   mutex::scoped_lock lock(mutex_);
 
   std::size_t n = 0;
+  if (work_queues_)
+  {
+    lock.unlock();
+    for (; do_run_one_stealing(lock, this_thread, ec); )
+      if (n != (std::numeric_limits<std::size_t>::max)())
+        ++n;
+    return n;
+  }
+
   for (; do_run_one(lock, this_thread, ec); lock.lock())
     if (n != (std::numeric_limits<std::size_t>::max)())
       ++n;
@@ -230,11 +313,17 @@ std::size_t scheduler::run_one(boost::system::error_code& ec)
   }
 
   thread_info this_thread;
-  this_thread.private_outstanding_work = 0;
+  init_thread_info(this_thread);
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
 
+  if (work_queues_)
+  {
+    lock.unlock();
+    return do_run_one_stealing(lock, this_thread, ec);
+  }
+
   return do_run_one(lock, this_thread, ec);
 }
 
@@ -248,11 +337,15 @@ std::size_t scheduler::wait_one(long usec, boost::system::error_code& ec)
   }
 
   thread_info this_thread;
-  this_thread.private_outstanding_work = 0;
+  init_thread_info(this_thread);
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
 
+  // Handlers in the per-thread queues are run from the shared queue.
+  if (work_queues_)
+    flush_work_queues();
+
   return do_wait_one(lock, this_thread, usec, ec);
 }
 
@@ -266,7 +359,7 @@ std::size_t scheduler::poll(boost::system::error_code& ec)
   }
 
   thread_info this_thread;
-  this_thread.private_outstanding_work = 0;
+  init_thread_info(this_thread);
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -278,6 +371,10 @@ std::size_t scheduler::poll(boost::system::error_code& ec)
   if (one_thread_)
     if (thread_info* outer_info = static_cast<thread_info*>(ctx.next_by_key()))
       op_queue_.push(outer_info->private_op_queue);
+
+  // Handlers in the per-thread queues are run from the shared queue.
+  if (work_queues_)
+    flush_work_queues();
 #endif // defined(BOOST_ASIO_HAS_THREADS)
 
   std::size_t n = 0;
@@ -297,7 +394,7 @@ std::size_t scheduler::poll_one(boost::system::error_code& ec)
   }
 
   thread_info this_thread;
-  this_thread.private_outstanding_work = 0;
+  init_thread_info(this_thread);
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -309,6 +406,10 @@ std::size_t scheduler::poll_one(boost::system::error_code& ec)
   if (one_thread_)
     if (thread_info* outer_info = static_cast<thread_info*>(ctx.next_by_key()))
       op_queue_.push(outer_info->private_op_queue);
+
+  // Handlers in the per-thread queues are run from the shared queue.
+  if (work_queues_)
+    flush_work_queues();
 #endif // defined(BOOST_ASIO_HAS_THREADS)
 
   return do_poll_one(lock, this_thread, ec);
@@ -330,6 +431,12 @@ void scheduler::restart()
 {
   mutex::scoped_lock lock(mutex_);
   stopped_ = false;
+  for (std::size_t i = 0; i < num_work_queues_; ++i)
+  {
+    boost::asio::detail::mutex::scoped_lock queue_lock(
+        work_queues_[i].mutex_);
+    work_queues_[i].stopped_ = false;
+  }
 }
 
 void scheduler::compensating_work_started()
@@ -363,11 +470,39 @@ void scheduler::post_immediate_completion(
       return;
     }
   }
+
+  if (work_queues_)
+  {
+    if (thread_info_base* this_thread = thread_call_stack::contains(this))
+    {
+      work_started(this_thread, 1);
+      op_queue<operation> ops;
+      ops.push(op);
+      push_work_queue(*static_cast<thread_info*>(this_thread), ops);
+      return;
+    }
+  }
+
+  if (use_injection_queue_ && !thread_call_stack::contains(this))
+  {
+    work_started();
+    if (injection_queue_.push(op))
+    {
+      mutex::scoped_lock lock(mutex_);
+      wake_one_thread_and_unlock(lock);
+    }
+    return;
+  }
+
+  if (work_count_batch_ > 1)
+    work_started(thread_call_stack::contains(this), 1);
+  else
+    work_started();
 #else // defined(BOOST_ASIO_HAS_THREADS)
   (void)is_continuation;
+  work_started();
 #endif // defined(BOOST_ASIO_HAS_THREADS)
 
-  work_started();
   mutex::scoped_lock lock(mutex_);
   op_queue_.push(op);
   wake_one_thread_and_unlock(lock);
@@ -387,11 +522,26 @@ void scheduler::post_immediate_completions(std::size_t n,
       return;
     }
   }
+
+  if (work_queues_)
+  {
+    if (thread_info_base* this_thread = thread_call_stack::contains(this))
+    {
+      work_started(this_thread, static_cast<long>(n));
+      push_work_queue(*static_cast<thread_info*>(this_thread), ops);
+      return;
+    }
+  }
+
+  if (work_count_batch_ > 1)
+    work_started(thread_call_stack::contains(this), static_cast<long>(n));
+  else
+    increment(outstanding_work_, static_cast<long>(n));
 #else // defined(BOOST_ASIO_HAS_THREADS)
   (void)is_continuation;
+  increment(outstanding_work_, static_cast<long>(n));
 #endif // defined(BOOST_ASIO_HAS_THREADS)
 
-  increment(outstanding_work_, static_cast<long>(n));
   mutex::scoped_lock lock(mutex_);
   op_queue_.push(ops);
   wake_one_thread_and_unlock(lock);
@@ -408,6 +558,16 @@ void scheduler::post_deferred_completion(scheduler::operation* op)
       return;
     }
   }
+  else if (work_queues_)
+  {
+    if (thread_info_base* this_thread = thread_call_stack::contains(this))
+    {
+      op_queue<operation> ops;
+      ops.push(op);
+      push_work_queue(*static_cast<thread_info*>(this_thread), ops);
+      return;
+    }
+  }
 #endif // defined(BOOST_ASIO_HAS_THREADS)
 
   mutex::scoped_lock lock(mutex_);
@@ -429,6 +589,14 @@ void scheduler::post_deferred_completions(
         return;
       }
     }
+    else if (work_queues_)
+    {
+      if (thread_info_base* this_thread = thread_call_stack::contains(this))
+      {
+        push_work_queue(*static_cast<thread_info*>(this_thread), ops);
+        return;
+      }
+    }
 #endif // defined(BOOST_ASIO_HAS_THREADS)
 
     mutex::scoped_lock lock(mutex_);
@@ -441,6 +609,30 @@ void scheduler::do_dispatch(
     scheduler::operation* op)
 {
   work_started();
+
+#if defined(BOOST_ASIO_HAS_THREADS)
+  if (work_queues_)
+  {
+    if (thread_info_base* this_thread = thread_call_stack::contains(this))
+    {
+      op_queue<operation> ops;
+      ops.push(op);
+      push_work_queue(*static_cast<thread_info*>(this_thread), ops);
+      return;
+    }
+  }
+
+  if (use_injection_queue_ && !thread_call_stack::contains(this))
+  {
+    if (injection_queue_.push(op))
+    {
+      mutex::scoped_lock lock(mutex_);
+      wake_one_thread_and_unlock(lock);
+    }
+    return;
+  }
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+
   mutex::scoped_lock lock(mutex_);
   op_queue_.push(op);
   wake_one_thread_and_unlock(lock);
@@ -459,6 +651,16 @@ std::size_t scheduler::do_run_one(mutex::scoped_lock& lock,
 {
   while (!stopped_)
   {
+    flush_injection_queue();
+
+    // Count the work finished by this thread before it blocks.
+    if (this_thread.private_finished_work > 0
+        && (op_queue_.empty() || op_queue_.front() == &task_operation_))
+    {
+      if (!flush_finished_work(lock, this_thread))
+        continue;
+    }
+
     if (!op_queue_.empty())
     {
       // Prepare to execute first handler from queue.
@@ -468,7 +670,11 @@ std::size_t scheduler::do_run_one(mutex::scoped_lock& lock,
 
       if (o == &task_operation_)
       {
-        task_interrupted_ = more_handlers || task_usec_ == 0;
+        // While busy polling, the task does not need to be interrupted when
+        // handlers are added to the queue, as it does not block.
+        bool busy_poll = !more_handlers
+          && busy_poll_usec_ > 0 && task_usec_ != 0;
+        task_interrupted_ = more_handlers || task_usec_ == 0 || busy_poll;
 
         if (more_handlers && !one_thread_ && wait_usec_ != 0)
           wakeup_event_.unlock_and_signal_one(lock);
@@ -481,8 +687,11 @@ std::size_t scheduler::do_run_one(mutex::scoped_lock& lock,
         // Run the task. May throw an exception. Only block if the operation
         // queue is empty and we're not polling, otherwise we want to return
         // as soon as possible.
-        task_->run(more_handlers ? 0 : task_usec_,
-            this_thread.private_op_queue);
+        if (!busy_poll || !busy_poll_task(lock, this_thread))
+        {
+          task_->run(more_handlers ? 0 : task_usec_,
+              this_thread.private_op_queue);
+        }
       }
       else
       {
@@ -525,6 +734,143 @@ std::size_t scheduler::do_run_one(mutex::scoped_lock& lock,
   return 0;
 }
 
+std::size_t scheduler::do_run_one_stealing(mutex::scoped_lock& lock,
+    scheduler::thread_info& this_thread,
+    const boost::system::error_code& ec)
+{
+  for (;;)
+  {
+    // Run a handler from the per-thread queues without acquiring the lock
+    // that protects the shared queue. After a run of such handlers the shared
+    // queue is checked, so that handlers that repost themselves cannot starve
+    // the task and the handlers in the shared queue.
+    if (this_thread.work_queue_handlers < max_work_queue_handlers)
+    {
+      bool stopped = false;
+      if (operation* o = pop_work_queue(this_thread, stopped))
+      {
+        ++this_thread.work_queue_handlers;
+
+        // Ensure the count of outstanding work is decremented on block exit.
+        work_cleanup on_exit = { this, &lock, &this_thread };
+        (void)on_exit;
+
+        // Complete the operation. May throw an exception. Deletes the object.
+        o->complete(this, ec, o->task_result_);
+        this_thread.rethrow_pending_exception();
+
+        return 1;
+      }
+      else if (stopped)
+      {
+        return 0;
+      }
+    }
+    this_thread.work_queue_handlers = 0;
+
+    lock.lock();
+
+    if (stopped_)
+    {
+      lock.unlock();
+      return 0;
+    }
+
+    flush_injection_queue();
+
+    // Count the work finished by this thread before it blocks.
+    if (this_thread.private_finished_work > 0
+        && (op_queue_.empty() || op_queue_.front() == &task_operation_))
+    {
+      if (!flush_finished_work(lock, this_thread))
+      {
+        lock.unlock();
+        return 0;
+      }
+    }
+
+    if (!op_queue_.empty())
+    {
+      // Prepare to execute first handler from queue.
+      operation* o = op_queue_.front();
+      op_queue_.pop();
+      bool more_handlers = (!op_queue_.empty());
+
+      if (o == &task_operation_)
+      {
+        // The task must not block while handlers are waiting in any of the
+        // per-thread queues.
+        task_blocked_ = 1;
+        more_handlers = more_handlers || work_queues_have_operations();
+        bool busy_poll = !more_handlers
+          && busy_poll_usec_ > 0 && task_usec_ != 0;
+        task_interrupted_ = more_handlers || task_usec_ == 0 || busy_poll;
+
+        if (more_handlers && wait_usec_ != 0)
+          wakeup_event_.unlock_and_signal_one(lock);
+        else
+          lock.unlock();
+
+        {
+          task_cleanup on_exit = { this, &lock, &this_thread };
+          (void)on_exit;
+
+          // Run the task. May throw an exception. Only block if the operation
+          // queue is empty and we're not polling, otherwise we want to return
+          // as soon as possible.
+          if (!busy_poll || !busy_poll_task(lock, this_thread))
+          {
+            task_->run(more_handlers ? 0 : task_usec_,
+                this_thread.private_op_queue);
+          }
+        }
+
+        lock.unlock();
+      }
+      else
+      {
+        std::size_t task_result = o->task_result_;
+
+        if (more_handlers)
+          wake_one_thread_and_unlock(lock);
+        else
+          lock.unlock();
+
+        // Ensure the count of outstanding work is decremented on block exit.
+        work_cleanup on_exit = { this, &lock, &this_thread };
+        (void)on_exit;
+
+        // Complete the operation. May throw an exception. Deletes the object.
+        o->complete(this, ec, task_result);
+        this_thread.rethrow_pending_exception();
+
+        return 1;
+      }
+    }
+    else if (wait_usec_ == 0)
+    {
+      lock.unlock();
+    }
+    else
+    {
+      // Threads that add handlers to their own queues wake an idle thread
+      // only if the count is non-zero, so the queues are checked again after
+      // incrementing it.
+      ++idle_threads_;
+      if (!work_queues_have_operations())
+      {
+        wakeup_event_.clear(lock);
+        if (wait_usec_ > 0)
+          wakeup_event_.wait_for_usec(lock, wait_usec_);
+        else
+          wakeup_event_.wait(lock);
+      }
+      --idle_threads_;
+      lock.unlock();
+    }
+  }
+}
+
 std::size_t scheduler::do_wait_one(mutex::scoped_lock& lock,
     scheduler::thread_info& this_thread, long usec,
     const boost::system::error_code& ec)
@@ -532,6 +878,8 @@ std::size_t scheduler::do_wait_one(mutex::scoped_lock& lock,
   if (stopped_)
     return 0;
 
+  flush_injection_queue();
+
   operation* o = op_queue_.front();
   if (o == 0)
   {
@@ -539,6 +887,7 @@ std::size_t scheduler::do_wait_one(mutex::scoped_lock& lock,
     usec = (wait_usec_ >= 0 && wait_usec_ < usec) ? wait_usec_ : usec;
     wakeup_event_.wait_for_usec(lock, usec);
     usec = 0; // Wait at most once.
+    flush_injection_queue();
     o = op_queue_.front();
   }
 
@@ -547,6 +896,12 @@ std::size_t scheduler::do_wait_one(mutex::scoped_lock& lock,
     op_queue_.pop();
     bool more_handlers = (!op_queue_.empty());
 
+    if (work_queues_)
+    {
+      task_blocked_ = 1;
+      more_handlers = more_handlers || work_queues_have_operations();
+    }
+
     usec = (task_usec_ >= 0 && task_usec_ < usec) ? task_usec_ : usec;
     task_interrupted_ = more_handlers || usec == 0;
 
@@ -605,6 +960,8 @@ std::size_t scheduler::do_poll_one(mutex::scoped_lock& lock,
   if (stopped_)
     return 0;
 
+  flush_injection_queue();
+
   operation* o = op_queue_.front();
   if (o == &task_operation_)
   {
@@ -653,10 +1010,192 @@ std::size_t scheduler::do_poll_one(mutex::scoped_lock& lock,
   return 1;
 }
 
+bool scheduler::busy_poll_task(mutex::scoped_lock& lock,
+    scheduler::thread_info& this_thread)
+{
+  typedef chrono::steady_clock clock_type;
+  const clock_type::time_point start = clock_type::now();
+
+  for (;;)
+  {
+    // Poll the task. May throw an exception.
+    task_->run(0, this_thread.private_op_queue);
+    bool found_work = !this_thread.private_op_queue.empty();
+
+    lock.lock();
+    if (work_queues_)
+      task_blocked_ = 1;
+    found_work = found_work || stopped_ || !op_queue_.empty()
+      || (use_injection_queue_ && !injection_queue_.empty())
+      || (work_queues_ && work_queues_have_operations());
+
+    long elapsed_usec = static_cast<long>(
+        chrono::duration_cast<chrono::microseconds>(
+          clock_type::now() - start).count());
+
+    if (found_work)
+    {
+      // Restore the full budget, as there is likely to be more work soon.
+      busy_poll_budget_usec_ = busy_poll_usec_;
+      lock.unlock();
+      return true;
+    }
+    else if (elapsed_usec >= busy_poll_budget_usec_)
+    {
+      // Spend less time polling next time, but keep a minimum budget so that
+      // polling resumes as soon as work arrives.
+      if (busy_poll_budget_usec_ > busy_poll_usec_ / 16)
+        busy_poll_budget_usec_ /= 2;
+
+      // Any handlers queued after this point must interrupt the task.
+      task_interrupted_ = false;
+      lock.unlock();
+      return false;
+    }
+
+    task_blocked_ = 0;
+    lock.unlock();
+  }
+}
+
+bool scheduler::flush_finished_work(mutex::scoped_lock& lock,
+    scheduler::thread_info& this_thread)
+{
+  long finished = this_thread.private_finished_work;
+  this_thread.private_finished_work = 0;
+  if ((outstanding_work_ -= finished) == 0)
+  {
+    stop_all_threads(lock);
+    return false;
+  }
+  return true;
+}
+
+void scheduler::work_started(thread_info_base* this_thread, long n)
+{
+  thread_info* info = static_cast<thread_info*>(this_thread);
+  if (info && info->private_finished_work > 0)
+  {
+    long offset = (info->private_finished_work < n)
+      ? info->private_finished_work : n;
+    info->private_finished_work -= offset;
+    n -= offset;
+  }
+
+  if (n > 0)
+    increment(outstanding_work_, n);
+}
+
+void scheduler::init_thread_info(scheduler::thread_info& this_thread)
+{
+  this_thread.private_outstanding_work = 0;
+  this_thread.private_finished_work = 0;
+  this_thread.work_count_batch = 1;
+  this_thread.work_queue_index = 0;
+  this_thread.work_queue_handlers = 0;
+  if (work_queues_)
+  {
+    this_thread.work_queue_index = static_cast<std::size_t>(
+        next_work_queue_++) % num_work_queues_;
+  }
+}
+
+void scheduler::push_work_queue(scheduler::thread_info& this_thread,
+    op_queue<scheduler::operation>& ops)
+{
+  work_queue& q = work_queues_[this_thread.work_queue_index];
+  {
+    boost::asio::detail::mutex::scoped_lock queue_lock(q.mutex_);
+    q.op_queue_.push(ops);
+  }
+
+  // The lock is needed only to wake an idle thread, or to interrupt the task
+  // if it may block. Both counts are updated before the queues are checked.
+  if (idle_threads_ == 0 && task_blocked_ == 0)
+    return;
+
+  // If no thread is idle, another thread may be blocked in the task, and
+  // must be interrupted so that it can steal the handlers.
+  mutex::scoped_lock lock(mutex_);
+  if (idle_threads_ == 0 || !wakeup_event_.maybe_unlock_and_signal_one(lock))
+  {
+    if (!task_interrupted_ && task_)
+    {
+      task_interrupted_ = true;
+      task_blocked_ = 0;
+      task_->interrupt();
+    }
+    lock.unlock();
+  }
+}
+
+scheduler::operation* scheduler::pop_work_queue(
+    scheduler::thread_info& this_thread, bool& stopped)
+{
+  // Try the thread's own queue first, then the other queues in turn.
+  for (std::size_t i = 0; i < num_work_queues_; ++i)
+  {
+    work_queue& q = work_queues_[
+      (this_thread.work_queue_index + i) % num_work_queues_];
+    boost::asio::detail::mutex::scoped_lock queue_lock(q.mutex_);
+    if (q.stopped_)
+    {
+      stopped = true;
+      return 0;
+    }
+    if (operation* o = q.op_queue_.front())
+    {
+      q.op_queue_.pop();
+      return o;
+    }
+  }
+  return 0;
+}
+
+bool scheduler::work_queues_have_operations()
+{
+  for (std::size_t i = 0; i < num_work_queues_; ++i)
+  {
+    boost::asio::detail::mutex::scoped_lock queue_lock(
+        work_queues_[i].mutex_);
+    if (!work_queues_[i].op_queue_.empty())
+      return true;
+  }
+  return false;
+}
+
+void scheduler::flush_work_queues()
+{
+  for (std::size_t i = 0; i < num_work_queues_; ++i)
+  {
+    boost::asio::detail::mutex::scoped_lock queue_lock(
+        work_queues_[i].mutex_);
+    op_queue_.push(work_queues_[i].op_queue_);
+  }
+}
+
+void scheduler::flush_injection_queue()
+{
+  // Handlers already in the shared queue are run first. The queue is always
+  // flushed before the task is run or a thread waits for handlers.
+  if (use_injection_queue_)
+  {
+    operation* o = op_queue_.front();
+    if (o == 0 || o == &task_operation_)
+      injection_queue_.pop_all(op_queue_);
+  }
+}
+
 void scheduler::stop_all_threads(
     mutex::scoped_lock& lock)
 {
   stopped_ = true;
+  for (std::size_t i = 0; i < num_work_queues_; ++i)
+  {
+    boost::asio::detail::mutex::scoped_lock queue_lock(
+        work_queues_[i].mutex_);
+    work_queues_[i].stopped_ = true;
+  }
   wakeup_event_.signal_all(lock);
 
   if (!task_interrupted_ && task_)
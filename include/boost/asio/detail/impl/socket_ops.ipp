@@ -1655,6 +1655,65 @@ bool non_blocking_send1(socket_type s,
   }
 }
 
+#if defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+
+bool non_blocking_zero_copy_complete(socket_type s,
+    unsigned int sequence, boost::system::error_code& ec)
+{
+  for (;;)
+  {
+    // Read the next notification from the error queue.
+    union
+    {
+      cmsghdr align;
+      char data[CMSG_SPACE(sizeof(sock_extended_err))
+        + CMSG_SPACE(sizeof(sockaddr_in6))];
+    } control;
+    msghdr msg = msghdr();
+    msg.msg_control = control.data;
+    msg.msg_controllen = sizeof(control.data);
+    signed_size_type result = ::recvmsg(s, &msg, MSG_ERRQUEUE);
+    get_last_error(ec, result < 0);
+
+    if (result < 0)
+    {
+      // Retry operation if interrupted by signal.
+      if (ec == boost::asio::error::interrupted)
+        continue;
+
+      // Check if we need to wait for the notification.
+      if (ec == boost::asio::error::would_block
+          || ec == boost::asio::error::try_again)
+      {
+        boost::asio::error::clear(ec);
+        return false;
+      }
+
+      // Operation failed.
+      return true;
+    }
+
+    // Notifications identify an inclusive range of sends. The sequence
+    // numbers wrap, so the comparison is made using the difference.
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg != 0; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+      if ((cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_RECVERR)
+          || (cmsg->cmsg_level == IPPROTO_IPV6
+            && cmsg->cmsg_type == IPV6_RECVERR))
+      {
+        sock_extended_err err;
+        std::memcpy(&err, CMSG_DATA(cmsg), sizeof(err));
+        if (err.ee_errno == 0 && err.ee_origin == SO_EE_ORIGIN_ZEROCOPY
+            && static_cast<int>(err.ee_data - sequence) >= 0)
+          return true;
+      }
+    }
+  }
+}
+
+#endif // defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+
 #endif // defined(BOOST_ASIO_HAS_IOCP)
 
 signed_size_type sendto(socket_type s, const buf* bufs,
@@ -1869,6 +1928,348 @@ bool non_blocking_sendto1(socket_type s,
   }
 }
 
+signed_size_type sendmmsg(socket_type s, batched_datagram* msgs,
+    size_t count, int flags, boost::system::error_code& ec)
+{
+  if (count > max_batched_datagrams)
+    count = max_batched_datagrams;
+
+#if defined(BOOST_ASIO_HAS_SENDMMSG)
+# if defined(BOOST_ASIO_HAS_MSG_NOSIGNAL)
+  flags |= MSG_NOSIGNAL;
+# endif // defined(BOOST_ASIO_HAS_MSG_NOSIGNAL)
+  ::iovec iovs[max_batched_datagrams];
+  ::mmsghdr mmsgs[max_batched_datagrams];
+  for (size_t i = 0; i < count; ++i)
+  {
+    iovs[i].iov_base = msgs[i].data;
+    iovs[i].iov_len = msgs[i].size;
+    mmsgs[i] = ::mmsghdr();
+    mmsgs[i].msg_hdr.msg_name = msgs[i].addr;
+    mmsgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(msgs[i].addrlen);
+    mmsgs[i].msg_hdr.msg_iov = &iovs[i];
+    mmsgs[i].msg_hdr.msg_iovlen = 1;
+  }
+  int result = ::sendmmsg(s, mmsgs, static_cast<unsigned int>(count), flags);
+  get_last_error(ec, result < 0);
+  for (int i = 0; i < result; ++i)
+    msgs[i].bytes_transferred = mmsgs[i].msg_len;
+  return result;
+#else // defined(BOOST_ASIO_HAS_SENDMMSG)
+  // Send the datagrams one at a time, stopping at the first failure.
+  size_t n = 0;
+  for (; n < count; ++n)
+  {
+    signed_size_type bytes = socket_ops::sendto1(s, msgs[n].data,
+        msgs[n].size, flags, msgs[n].addr, msgs[n].addrlen, ec);
+    if (bytes < 0)
+      break;
+    msgs[n].bytes_transferred = bytes;
+  }
+  if (n == 0 && count != 0)
+    return socket_error_retval;
+  boost::asio::error::clear(ec);
+  return static_cast<signed_size_type>(n);
+#endif // defined(BOOST_ASIO_HAS_SENDMMSG)
+}
+
+bool non_blocking_sendmmsg(socket_type s,
+    batched_datagram* msgs, size_t count, int flags,
+    boost::system::error_code& ec, size_t& datagrams_transferred)
+{
+  for (;;)
+  {
+    // Write some datagrams.
+    signed_size_type datagrams = socket_ops::sendmmsg(
+        s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (datagrams >= 0)
+    {
+      datagrams_transferred = datagrams;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == boost::asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == boost::asio::error::would_block
+        || ec == boost::asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    datagrams_transferred = 0;
+    return true;
+  }
+}
+
+signed_size_type recvmmsg(socket_type s, batched_datagram* msgs,
+    size_t count, int flags, boost::system::error_code& ec)
+{
+  if (count > max_batched_datagrams)
+    count = max_batched_datagrams;
+
+#if defined(BOOST_ASIO_HAS_SENDMMSG)
+  ::iovec iovs[max_batched_datagrams];
+  ::mmsghdr mmsgs[max_batched_datagrams];
+  for (size_t i = 0; i < count; ++i)
+  {
+    iovs[i].iov_base = msgs[i].data;
+    iovs[i].iov_len = msgs[i].size;
+    mmsgs[i] = ::mmsghdr();
+    mmsgs[i].msg_hdr.msg_name = msgs[i].addr;
+    mmsgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(msgs[i].addrlen);
+    mmsgs[i].msg_hdr.msg_iov = &iovs[i];
+    mmsgs[i].msg_hdr.msg_iovlen = 1;
+  }
+  int result = ::recvmmsg(s, mmsgs, static_cast<unsigned int>(count), flags, 0);
+  get_last_error(ec, result < 0);
+  for (int i = 0; i < result; ++i)
+  {
+    msgs[i].addrlen = mmsgs[i].msg_hdr.msg_namelen;
+    msgs[i].bytes_transferred = mmsgs[i].msg_len;
+  }
+  return result;
+#else // defined(BOOST_ASIO_HAS_SENDMMSG)
+  // Receive the datagrams one at a time, stopping at the first failure.
+  size_t n = 0;
+  for (; n < count; ++n)
+  {
+    signed_size_type bytes = socket_ops::recvfrom1(s, msgs[n].data,
+        msgs[n].size, flags, msgs[n].addr, &msgs[n].addrlen, ec);
+    if (bytes < 0)
+      break;
+    msgs[n].bytes_transferred = bytes;
+  }
+  if (n == 0 && count != 0)
+    return socket_error_retval;
+  boost::asio::error::clear(ec);
+  return static_cast<signed_size_type>(n);
+#endif // defined(BOOST_ASIO_HAS_SENDMMSG)
+}
+
+bool non_blocking_recvmmsg(socket_type s,
+    batched_datagram* msgs, size_t count, int flags,
+    boost::system::error_code& ec, size_t& datagrams_transferred)
+{
+  for (;;)
+  {
+    // Read some datagrams.
+    signed_size_type datagrams = socket_ops::recvmmsg(
+        s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (datagrams >= 0)
+    {
+      datagrams_transferred = datagrams;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == boost::asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == boost::asio::error::would_block
+        || ec == boost::asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    datagrams_transferred = 0;
+    return true;
+  }
+}
+
+bool check_segment_size(std::size_t segment_size,
+    boost::system::error_code& ec)
+{
+  if (segment_size == 0)
+  {
+    boost::asio::error::clear(ec);
+    return true;
+  }
+
+#if defined(BOOST_ASIO_HAS_UDP_GSO)
+  if (segment_size > 0xFFFF)
+  {
+    ec = boost::asio::error::invalid_argument;
+    return false;
+  }
+
+  boost::asio::error::clear(ec);
+  return true;
+#else // defined(BOOST_ASIO_HAS_UDP_GSO)
+  ec = boost::asio::error::operation_not_supported;
+  return false;
+#endif // defined(BOOST_ASIO_HAS_UDP_GSO)
+}
+
+signed_size_type sendto_segmented(socket_type s, const buf* bufs,
+    size_t count, int flags, const void* addr, std::size_t addrlen,
+    std::size_t segment_size, boost::system::error_code& ec)
+{
+  if (segment_size == 0)
+    return socket_ops::sendto(s, bufs, count, flags, addr, addrlen, ec);
+
+  if (!check_segment_size(segment_size, ec))
+    return socket_error_retval;
+
+#if defined(BOOST_ASIO_HAS_UDP_GSO)
+  msghdr msg = msghdr();
+  init_msghdr_msg_name(msg.msg_name, addr);
+  msg.msg_namelen = static_cast<int>(addrlen);
+  msg.msg_iov = const_cast<buf*>(bufs);
+  msg.msg_iovlen = static_cast<int>(count);
+  segment_size_control control;
+  init_segment_size_control(msg, control, segment_size);
+#if defined(BOOST_ASIO_HAS_MSG_NOSIGNAL)
+  flags |= MSG_NOSIGNAL;
+#endif // defined(BOOST_ASIO_HAS_MSG_NOSIGNAL)
+  signed_size_type result = ::sendmsg(s, &msg, flags);
+  get_last_error(ec, result < 0);
+  return result;
+#else // defined(BOOST_ASIO_HAS_UDP_GSO)
+  return socket_error_retval;
+#endif // defined(BOOST_ASIO_HAS_UDP_GSO)
+}
+
+bool non_blocking_sendto_segmented(socket_type s, const buf* bufs,
+    size_t count, int flags, const void* addr, std::size_t addrlen,
+    std::size_t segment_size, boost::system::error_code& ec,
+    size_t& bytes_transferred)
+{
+  for (;;)
+  {
+    // Write some data.
+    signed_size_type bytes = socket_ops::sendto_segmented(
+        s, bufs, count, flags, addr, addrlen, segment_size, ec);
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == boost::asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == boost::asio::error::would_block
+        || ec == boost::asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+signed_size_type recvfrom_coalesced(socket_type s, buf* bufs,
+    size_t count, int flags, void* addr, std::size_t* addrlen,
+    std::size_t* segment_size, boost::system::error_code& ec)
+{
+#if defined(BOOST_ASIO_HAS_UDP_GSO)
+  msghdr msg = msghdr();
+  init_msghdr_msg_name(msg.msg_name, addr);
+  msg.msg_namelen = static_cast<int>(*addrlen);
+  msg.msg_iov = bufs;
+  msg.msg_iovlen = static_cast<int>(count);
+  segment_size_control control;
+  init_coalesced_control(msg, control);
+  signed_size_type result = ::recvmsg(s, &msg, flags);
+  get_last_error(ec, result < 0);
+  *addrlen = msg.msg_namelen;
+  if (result >= 0)
+    *segment_size = get_coalesced_segment_size(msg, result);
+  return result;
+#else // defined(BOOST_ASIO_HAS_UDP_GSO)
+  signed_size_type result = socket_ops::recvfrom(
+      s, bufs, count, flags, addr, addrlen, ec);
+  if (result >= 0)
+    *segment_size = result;
+  return result;
+#endif // defined(BOOST_ASIO_HAS_UDP_GSO)
+}
+
+bool non_blocking_recvfrom_coalesced(socket_type s, buf* bufs,
+    size_t count, int flags, void* addr, std::size_t* addrlen,
+    std::size_t* segment_size, boost::system::error_code& ec,
+    size_t& bytes_transferred)
+{
+  for (;;)
+  {
+    // Read some data.
+    signed_size_type bytes = socket_ops::recvfrom_coalesced(
+        s, bufs, count, flags, addr, addrlen, segment_size, ec);
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == boost::asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == boost::asio::error::would_block
+        || ec == boost::asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+#if defined(BOOST_ASIO_HAS_UDP_GSO)
+
+void init_segment_size_control(msghdr& msg,
+    segment_size_control& control, std::size_t segment_size)
+{
+  std::memset(&control, 0, sizeof(control));
+  msg.msg_control = control.data;
+  msg.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = BOOST_ASIO_OS_DEF(IPPROTO_UDP);
+  cmsg->cmsg_type = BOOST_ASIO_OS_DEF(UDP_SEGMENT);
+  cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+  uint16_t value = static_cast<uint16_t>(segment_size);
+  std::memcpy(CMSG_DATA(cmsg), &value, sizeof(value));
+}
+
+void init_coalesced_control(msghdr& msg, segment_size_control& control)
+{
+  msg.msg_control = control.data;
+  msg.msg_controllen = sizeof(control.data);
+}
+
+std::size_t get_coalesced_segment_size(
+    msghdr& msg, std::size_t bytes_transferred)
+{
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+      cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+  {
+    if (cmsg->cmsg_level == BOOST_ASIO_OS_DEF(IPPROTO_UDP)
+        && cmsg->cmsg_type == BOOST_ASIO_OS_DEF(UDP_GRO))
+    {
+      int value = 0;
+      std::memcpy(&value, CMSG_DATA(cmsg), sizeof(value));
+      if (value > 0)
+        return static_cast<std::size_t>(value);
+    }
+  }
+  return bytes_transferred;
+}
+
+#endif // defined(BOOST_ASIO_HAS_UDP_GSO)
+
 #endif // !defined(BOOST_ASIO_HAS_IOCP)
 
 socket_type socket(int af, int type, int protocol,
@@ -1956,6 +2357,87 @@ int setsockopt(socket_type s, state_type& state, int level, int optname,
     return 0;
   }
 
+  if (level == custom_socket_option_level
+      && optname == multishot_accept_option)
+  {
+    if (optlen != sizeof(int))
+    {
+      ec = boost::asio::error::invalid_argument;
+      return socket_error_retval;
+    }
+
+    if (*static_cast<const int*>(optval))
+      state |= multishot_accept;
+    else
+      state &= ~multishot_accept;
+    boost::asio::error::clear(ec);
+    return 0;
+  }
+
+  if (level == custom_socket_option_level
+      && optname == multishot_receive_option)
+  {
+    if (optlen != sizeof(int))
+    {
+      ec = boost::asio::error::invalid_argument;
+      return socket_error_retval;
+    }
+
+    if (*static_cast<const int*>(optval))
+      state |= multishot_receive;
+    else
+      state &= ~multishot_receive;
+    boost::asio::error::clear(ec);
+    return 0;
+  }
+
+  if (level == custom_socket_option_level
+      && optname == zero_copy_send_option)
+  {
+    if (optlen != sizeof(int))
+    {
+      ec = boost::asio::error::invalid_argument;
+      return socket_error_retval;
+    }
+
+#if defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+    // The kernel only honours MSG_ZEROCOPY once it has been enabled on the
+    // socket, otherwise no completion notifications are generated.
+    if (*static_cast<const int*>(optval))
+    {
+      int result = ::setsockopt(s, SOL_SOCKET, SO_ZEROCOPY,
+          static_cast<const char*>(optval), static_cast<socklen_t>(optlen));
+      get_last_error(ec, result != 0);
+      if (result != 0)
+        return result;
+    }
+#endif // defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+
+    if (*static_cast<const int*>(optval))
+      state |= zero_copy_send;
+    else
+      state &= ~zero_copy_send;
+    boost::asio::error::clear(ec);
+    return 0;
+  }
+
+  if (level == custom_socket_option_level
+      && optname == inline_completion_option)
+  {
+    if (optlen != sizeof(int))
+    {
+      ec = boost::asio::error::invalid_argument;
+      return socket_error_retval;
+    }
+
+    if (*static_cast<const int*>(optval))
+      state |= inline_completion;
+    else
+      state &= ~inline_completion;
+    boost::asio::error::clear(ec);
+    return 0;
+  }
+
   if (level == SOL_SOCKET && optname == SO_LINGER)
     state |= user_set_linger;
 
@@ -2001,6 +2483,39 @@ int setsockopt(socket_type s, state_type& state, int level, int optname,
 #endif // defined(__BORLANDC__)
 }
 
+int set_busy_poll(socket_type s, state_type& state,
+    int usec, boost::system::error_code& ec)
+{
+#if defined(SO_BUSY_POLL)
+  int result = socket_ops::setsockopt(s, state,
+      SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec), ec);
+# if defined(SO_PREFER_BUSY_POLL)
+  if (result == 0)
+  {
+    int prefer = 1;
+    result = socket_ops::setsockopt(s, state,
+        SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer, sizeof(prefer), ec);
+  }
+# endif // defined(SO_PREFER_BUSY_POLL)
+  return result;
+#else // defined(SO_BUSY_POLL)
+  (void)s;
+  (void)state;
+  (void)usec;
+  ec = boost::asio::error::operation_not_supported;
+  return socket_error_retval;
+#endif // defined(SO_BUSY_POLL)
+}
+
+void maybe_set_busy_poll(socket_type s, state_type& state, int usec)
+{
+  if (usec > 0)
+  {
+    boost::system::error_code ignored_ec;
+    socket_ops::set_busy_poll(s, state, usec, ignored_ec);
+  }
+}
+
 template <typename SockLenType>
 inline int call_getsockopt(SockLenType msghdr::*,
     socket_type s, int level, int optname,
@@ -2041,6 +2556,62 @@ int getsockopt(socket_type s, state_type state, int level, int optname,
     return 0;
   }
 
+  if (level == custom_socket_option_level
+      && optname == multishot_accept_option)
+  {
+    if (*optlen != sizeof(int))
+    {
+      ec = boost::asio::error::invalid_argument;
+      return socket_error_retval;
+    }
+
+    *static_cast<int*>(optval) = (state & multishot_accept) ? 1 : 0;
+    boost::asio::error::clear(ec);
+    return 0;
+  }
+
+  if (level == custom_socket_option_level
+      && optname == multishot_receive_option)
+  {
+    if (*optlen != sizeof(int))
+    {
+      ec = boost::asio::error::invalid_argument;
+      return socket_error_retval;
+    }
+
+    *static_cast<int*>(optval) = (state & multishot_receive) ? 1 : 0;
+    boost::asio::error::clear(ec);
+    return 0;
+  }
+
+  if (level == custom_socket_option_level
+      && optname == zero_copy_send_option)
+  {
+    if (*optlen != sizeof(int))
+    {
+      ec = boost::asio::error::invalid_argument;
+      return socket_error_retval;
+    }
+
+    *static_cast<int*>(optval) = (state & zero_copy_send) ? 1 : 0;
+    boost::asio::error::clear(ec);
+    return 0;
+  }
+
+  if (level == custom_socket_option_level
+      && optname == inline_completion_option)
+  {
+    if (*optlen != sizeof(int))
+    {
+      ec = boost::asio::error::invalid_argument;
+      return socket_error_retval;
+    }
+
+    *static_cast<int*>(optval) = (state & inline_completion) ? 1 : 0;
+    boost::asio::error::clear(ec);
+    return 0;
+  }
+
 #if defined(__BORLANDC__)
   // Mysteriously, using the getsockopt and setsockopt functions directly with
   // Borland C++ results in incorrect values being set and read. The bug can be
@@ -16,6 +16,8 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include <boost/asio/detail/config.hpp>
+#include <boost/asio/config.hpp>
+#include <boost/asio/detail/chrono.hpp>
 #include <boost/asio/detail/strand_executor_service.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
@@ -26,8 +28,9 @@ namespace detail {
 
 strand_executor_service::strand_executor_service(execution_context& ctx)
   : execution_context_service_base<strand_executor_service>(ctx),
+    handler_budget_(config(ctx).get("strand", "handler_budget", 0U)),
+    time_slice_usec_(config(ctx).get("strand", "time_slice_usec", 0L)),
     mutex_(),
-    salt_(0),
     impl_list_(0)
 {
 }
@@ -41,11 +44,9 @@ void strand_executor_service::shutdown()
   strand_impl* impl = impl_list_;
   while (impl)
   {
-    impl->mutex_->lock();
-    impl->shutdown_ = true;
-    ops.push(impl->waiting_queue_);
+    impl->state_.shutdown(ops);
     ops.push(impl->ready_queue_);
-    impl->mutex_->unlock();
+    impl->ready_count_ = 0;
     impl = impl->next_;
   }
 }
@@ -55,21 +56,9 @@ strand_executor_service::create_implementation()
 {
   execution_context::allocator<void> alloc(context());
   implementation_type new_impl = allocate_shared<strand_impl>(alloc);
-  new_impl->locked_ = false;
-  new_impl->shutdown_ = false;
 
   boost::asio::detail::mutex::scoped_lock lock(mutex_);
 
-  // Select a mutex from the pool of shared mutexes.
-  std::size_t salt = salt_++;
-  std::size_t mutex_index = reinterpret_cast<std::size_t>(new_impl.get());
-  mutex_index += (reinterpret_cast<std::size_t>(new_impl.get()) >> 3);
-  mutex_index ^= salt + 0x9e3779b9 + (mutex_index << 6) + (mutex_index >> 2);
-  mutex_index = mutex_index % num_mutexes;
-  if (!mutexes_[mutex_index])
-    mutexes_[mutex_index] = allocate_shared<mutex>(alloc);
-  new_impl->mutex_ = mutexes_[mutex_index].get();
-
   // Insert implementation into linked list of all implementations.
   new_impl->next_ = impl_list_;
   new_impl->prev_ = 0;
@@ -77,6 +66,12 @@ strand_executor_service::create_implementation()
     impl_list_->prev_ = new_impl.get();
   impl_list_ = new_impl.get();
   new_impl->service_ = this;
+  new_impl->ready_count_ = 0;
+  store_statistic(new_impl->turns_, 0);
+  store_statistic(new_impl->handlers_, 0);
+  store_statistic(new_impl->max_handlers_per_turn_, 0);
+  store_statistic(new_impl->max_queue_depth_, 0);
+  store_statistic(new_impl->yields_, 0);
 
   return new_impl;
 }
@@ -97,28 +92,21 @@ strand_executor_service::strand_impl::~strand_impl()
 bool strand_executor_service::enqueue(const implementation_type& impl,
     scheduler_operation* op)
 {
-  impl->mutex_->lock();
-  if (impl->shutdown_)
-  {
-    impl->mutex_->unlock();
-    op->destroy();
-    return false;
-  }
-  else if (impl->locked_)
-  {
-    // Some other function already holds the strand lock. Enqueue for later.
-    impl->waiting_queue_.push(op);
-    impl->mutex_->unlock();
-    return false;
-  }
-  else
+  switch (impl->state_.enqueue(op))
   {
+  case strand_state<scheduler_operation>::acquired:
     // The function is acquiring the strand lock and so is responsible for
     // scheduling the strand.
-    impl->locked_ = true;
-    impl->mutex_->unlock();
     impl->ready_queue_.push(op);
+    impl->ready_count_ = 1;
     return true;
+  case strand_state<scheduler_operation>::waiting:
+    // Some other function already holds the strand lock. Enqueued for later.
+    return false;
+  default:
+    // The strand has been shut down.
+    op->destroy();
+    return false;
   }
 }
 
@@ -128,13 +116,22 @@ bool strand_executor_service::running_in_this_thread(
   return !!call_stack<strand_impl>::contains(impl.get());
 }
 
+strand_statistics strand_executor_service::statistics(
+    const implementation_type& impl)
+{
+  strand_statistics stats;
+  stats.turns = load_statistic(impl->turns_);
+  stats.handlers = load_statistic(impl->handlers_);
+  stats.max_handlers_per_turn = load_statistic(impl->max_handlers_per_turn_);
+  stats.max_queue_depth = load_statistic(impl->max_queue_depth_);
+  stats.yields = load_statistic(impl->yields_);
+  return stats;
+}
+
 bool strand_executor_service::push_waiting_to_ready(implementation_type& impl)
 {
-  impl->mutex_->lock();
-  impl->ready_queue_.push(impl->waiting_queue_);
-  bool more_handlers = impl->locked_ = !impl->ready_queue_.empty();
-  impl->mutex_->unlock();
-  return more_handlers;
+  return impl->state_.push_waiting_to_ready(
+      impl->ready_queue_, impl->ready_count_);
 }
 
 void strand_executor_service::run_ready_handlers(implementation_type& impl)
@@ -142,12 +139,35 @@ void strand_executor_service::run_ready_handlers(implementation_type& impl)
   // Indicate that this strand is executing on the current thread.
   call_stack<strand_impl>::context ctx(impl.get());
 
-  // Run all ready handlers. No lock is required since the ready queue is
-  // accessed only within the strand.
+  store_statistic(impl->turns_, load_statistic(impl->turns_) + 1);
+  if (impl->ready_count_ > load_statistic(impl->max_queue_depth_))
+    store_statistic(impl->max_queue_depth_, impl->ready_count_);
+
+  // Run the ready handlers, up to the configured budget and time slice. Any
+  // handlers that remain are run after the strand is next scheduled. No lock
+  // is required since the ready queue is accessed only within the strand.
+  typedef chrono::steady_clock clock_type;
+  const std::size_t budget = impl->service_->handler_budget_;
+  const long time_slice_usec = impl->service_->time_slice_usec_;
+  const clock_type::time_point start = time_slice_usec > 0
+    ? clock_type::now() : clock_type::time_point();
+  std::size_t count = 0;
   boost::system::error_code ec;
   while (scheduler_operation* o = impl->ready_queue_.front())
   {
+    if ((budget > 0 && count >= budget) || (time_slice_usec > 0 && count > 0
+          && chrono::duration_cast<chrono::microseconds>(
+            clock_type::now() - start).count() >= time_slice_usec))
+    {
+      store_statistic(impl->yields_, load_statistic(impl->yields_) + 1);
+      break;
+    }
+
     impl->ready_queue_.pop();
+    --impl->ready_count_;
+    store_statistic(impl->handlers_, load_statistic(impl->handlers_) + 1);
+    if (++count > load_statistic(impl->max_handlers_per_turn_))
+      store_statistic(impl->max_handlers_per_turn_, count);
     o->complete(impl.get(), ec, 0);
   }
 }
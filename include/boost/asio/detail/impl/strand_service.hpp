@@ -27,8 +27,7 @@ namespace asio {
 namespace detail {
 
 inline strand_service::strand_impl::strand_impl()
-  : operation(&strand_service::do_complete),
-    locked_(false)
+  : operation(&strand_service::do_complete)
 {
 }
 
@@ -32,12 +32,7 @@ struct strand_service::on_do_complete_exit
 
   ~on_do_complete_exit()
   {
-    impl_->mutex_.lock();
-    impl_->ready_queue_.push(impl_->waiting_queue_);
-    bool more_handlers = impl_->locked_ = !impl_->ready_queue_.empty();
-    impl_->mutex_.unlock();
-
-    if (more_handlers)
+    if (impl_->state_.push_waiting_to_ready(impl_->ready_queue_))
       owner_->post_immediate_completion(impl_, true);
   }
 };
@@ -61,7 +56,7 @@ void strand_service::shutdown()
   {
     if (strand_impl* impl = implementations_[i].get())
     {
-      ops.push(impl->waiting_queue_);
+      impl->state_.shutdown(ops);
       ops.push(impl->ready_queue_);
     }
   }
@@ -102,12 +97,7 @@ struct strand_service::on_dispatch_exit
 
   ~on_dispatch_exit()
   {
-    impl_->mutex_.lock();
-    impl_->ready_queue_.push(impl_->waiting_queue_);
-    bool more_handlers = impl_->locked_ = !impl_->ready_queue_.empty();
-    impl_->mutex_.unlock();
-
-    if (more_handlers)
+    if (impl_->state_.push_waiting_to_ready(impl_->ready_queue_))
       io_context_impl_->post_immediate_completion(impl_, false);
   }
 };
@@ -116,15 +106,10 @@ void strand_service::do_dispatch(implementation_type& impl, operation* op)
 {
   // If we are running inside the io_context, and no other handler already
   // holds the strand lock, then the handler can run immediately.
-  bool can_dispatch = io_context_impl_.can_dispatch();
-  impl->mutex_.lock();
-  if (can_dispatch && !impl->locked_)
+  if (io_context_impl_.can_dispatch() && impl->state_.try_lock())
   {
-    // Immediate invocation is allowed.
-    impl->locked_ = true;
-    impl->mutex_.unlock();
-
-    // Indicate that this strand is executing on the current thread.
+    // Immediate invocation is allowed. Indicate that this strand is executing
+    // on the current thread.
     call_stack<strand_impl>::context ctx(impl);
 
     // Ensure the next handler, if any, is scheduled on block exit.
@@ -135,41 +120,28 @@ void strand_service::do_dispatch(implementation_type& impl, operation* op)
     return;
   }
 
-  if (impl->locked_)
-  {
-    // Some other handler already holds the strand lock. Enqueue for later.
-    impl->waiting_queue_.push(op);
-    impl->mutex_.unlock();
-  }
-  else
-  {
-    // The handler is acquiring the strand lock and so is responsible for
-    // scheduling the strand.
-    impl->locked_ = true;
-    impl->mutex_.unlock();
-    impl->ready_queue_.push(op);
-    io_context_impl_.post_immediate_completion(impl, false);
-  }
+  // Otherwise the handler is run when the strand is next scheduled.
+  do_post(impl, op, false);
 }
 
 void strand_service::do_post(implementation_type& impl,
     operation* op, bool is_continuation)
 {
-  impl->mutex_.lock();
-  if (impl->locked_)
-  {
-    // Some other handler already holds the strand lock. Enqueue for later.
-    impl->waiting_queue_.push(op);
-    impl->mutex_.unlock();
-  }
-  else
+  switch (impl->state_.enqueue(op))
   {
+  case strand_state<operation>::acquired:
     // The handler is acquiring the strand lock and so is responsible for
     // scheduling the strand.
-    impl->locked_ = true;
-    impl->mutex_.unlock();
     impl->ready_queue_.push(op);
     io_context_impl_.post_immediate_completion(impl, is_continuation);
+    break;
+  case strand_state<operation>::waiting:
+    // Some other handler already holds the strand lock. Enqueued for later.
+    break;
+  default:
+    // The strand has been shut down.
+    op->destroy();
+    break;
   }
 }
 
@@ -0,0 +1,181 @@
+//
+// detail/impl/thread_affinity.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_IMPL_THREAD_AFFINITY_IPP
+#define BOOST_ASIO_DETAIL_IMPL_THREAD_AFFINITY_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <boost/asio/detail/thread.hpp>
+#include <boost/asio/detail/thread_affinity.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+bool bind_this_thread_to_cpus(const std::vector<std::size_t>& cpus)
+{
+#if defined(BOOST_ASIO_WINDOWS_RUNTIME)
+  (void)cpus;
+  return false;
+#elif defined(BOOST_ASIO_WINDOWS) || defined(__CYGWIN__)
+  DWORD_PTR mask = 0;
+  for (std::size_t i = 0; i < cpus.size(); ++i)
+    if (cpus[i] < sizeof(DWORD_PTR) * 8)
+      mask |= static_cast<DWORD_PTR>(1) << cpus[i];
+  return mask != 0
+    && ::SetThreadAffinityMask(::GetCurrentThread(), mask) != 0;
+#elif defined(__linux__) && defined(BOOST_ASIO_HAS_PTHREADS) \
+  && defined(CPU_SETSIZE)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  bool any = false;
+  for (std::size_t i = 0; i < cpus.size(); ++i)
+  {
+    if (cpus[i] < CPU_SETSIZE)
+    {
+      CPU_SET(cpus[i], &cpu_set);
+      any = true;
+    }
+  }
+  return any && ::pthread_setaffinity_np(
+      ::pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+  (void)cpus;
+  return false;
+#endif
+}
+
+void get_available_cpus(std::vector<std::size_t>& cpus)
+{
+  cpus.clear();
+
+#if defined(BOOST_ASIO_WINDOWS_RUNTIME)
+  // Fall through to the default.
+#elif defined(BOOST_ASIO_WINDOWS) || defined(__CYGWIN__)
+  DWORD_PTR process_mask = 0;
+  DWORD_PTR system_mask = 0;
+  if (::GetProcessAffinityMask(::GetCurrentProcess(),
+        &process_mask, &system_mask))
+  {
+    for (std::size_t i = 0; i < sizeof(DWORD_PTR) * 8; ++i)
+      if (process_mask & (static_cast<DWORD_PTR>(1) << i))
+        cpus.push_back(i);
+  }
+#elif defined(__linux__) && defined(BOOST_ASIO_HAS_PTHREADS) \
+  && defined(CPU_SETSIZE)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (::pthread_getaffinity_np(::pthread_self(),
+        sizeof(cpu_set), &cpu_set) == 0)
+  {
+    for (std::size_t i = 0; i < CPU_SETSIZE; ++i)
+      if (CPU_ISSET(i, &cpu_set))
+        cpus.push_back(i);
+  }
+#endif
+
+  if (cpus.empty())
+  {
+    std::size_t num_cpus = thread::hardware_concurrency();
+    num_cpus = num_cpus == 0 ? 1 : num_cpus;
+    for (std::size_t i = 0; i < num_cpus; ++i)
+      cpus.push_back(i);
+  }
+}
+
+bool read_cpu_list(const char* path, std::vector<std::size_t>& cpus)
+{
+  cpus.clear();
+
+  std::FILE* file = std::fopen(path, "r");
+  if (!file)
+    return false;
+
+  char buf[4096];
+  bool result = std::fgets(buf, sizeof(buf), file) != 0;
+  std::fclose(file);
+  if (!result)
+    return false;
+
+  // The list is of the form "0-3,8,10-11".
+  const char* p = buf;
+  while (*p >= '0' && *p <= '9')
+  {
+    char* end = 0;
+    std::size_t first = static_cast<std::size_t>(std::strtoul(p, &end, 10));
+    std::size_t last = first;
+    p = end;
+    if (*p == '-')
+    {
+      last = static_cast<std::size_t>(std::strtoul(p + 1, &end, 10));
+      p = end;
+    }
+    for (std::size_t cpu = first; cpu <= last; ++cpu)
+      cpus.push_back(cpu);
+    if (*p == ',')
+      ++p;
+  }
+
+  return true;
+}
+
+void get_numa_node_cpus(std::vector<std::vector<std::size_t>>& nodes)
+{
+  nodes.clear();
+
+  std::vector<std::size_t> available;
+  get_available_cpus(available);
+
+#if defined(__linux__)
+  std::vector<std::size_t> node_ids;
+  if (read_cpu_list("/sys/devices/system/node/online", node_ids))
+  {
+    for (std::size_t i = 0; i < node_ids.size(); ++i)
+    {
+      char path[64];
+      std::snprintf(path, sizeof(path),
+          "/sys/devices/system/node/node%u/cpulist",
+          static_cast<unsigned>(node_ids[i]));
+
+      std::vector<std::size_t> node_cpus;
+      if (!read_cpu_list(path, node_cpus))
+        continue;
+
+      std::vector<std::size_t> cpus;
+      for (std::size_t j = 0; j < node_cpus.size(); ++j)
+        for (std::size_t k = 0; k < available.size(); ++k)
+          if (node_cpus[j] == available[k])
+            cpus.push_back(node_cpus[j]);
+
+      if (!cpus.empty())
+        nodes.push_back(cpus);
+    }
+  }
+#endif // defined(__linux__)
+
+  if (nodes.empty())
+    nodes.push_back(available);
+}
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_IMPL_THREAD_AFFINITY_IPP
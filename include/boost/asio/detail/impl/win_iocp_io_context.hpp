@@ -114,6 +114,66 @@ void win_iocp_io_context::move_timer(timer_queue<TimeTraits, Allocator>& queue,
   post_deferred_completions(ops);
 }
 
+template <typename TimeTraits, typename Allocator>
+void win_iocp_io_context::reschedule_timer(
+    timer_queue<TimeTraits, Allocator>& queue,
+    const typename TimeTraits::time_type& time,
+    typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer)
+{
+  // If the service has been shut down we silently ignore the change.
+  if (::InterlockedExchangeAdd(&shutdown_, 0) != 0)
+    return;
+
+  mutex::scoped_lock lock(dispatch_mutex_);
+  bool earliest = queue.reschedule_timer(time, timer);
+  if (earliest)
+    update_timeout();
+}
+
+template <typename TimeTraits, typename Allocator>
+void win_iocp_io_context::schedule_periodic_timer(
+    timer_queue<TimeTraits, Allocator>& queue,
+    typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer,
+    typename timer_queue<TimeTraits, Allocator>::periodic_op* op)
+{
+  // If the service has been shut down we silently discard the timer.
+  if (::InterlockedExchangeAdd(&shutdown_, 0) != 0)
+  {
+    post_immediate_completion(op, false);
+    return;
+  }
+
+  mutex::scoped_lock lock(dispatch_mutex_);
+
+  op_queue<operation> ops;
+  bool earliest = queue.enqueue_periodic(timer, op, ops);
+  work_started();
+  if (earliest)
+    update_timeout();
+  lock.unlock();
+  post_deferred_completions(ops);
+}
+
+template <typename TimeTraits, typename Allocator>
+bool win_iocp_io_context::requeue_periodic_timer(
+    timer_queue<TimeTraits, Allocator>& queue,
+    typename timer_queue<TimeTraits, Allocator>::periodic_op* op)
+{
+  // If the service has been shut down the operation is not queued again.
+  if (::InterlockedExchangeAdd(&shutdown_, 0) != 0)
+    return false;
+
+  mutex::scoped_lock lock(dispatch_mutex_);
+
+  bool earliest = false;
+  queue.requeue_periodic(op, earliest);
+
+  work_started();
+  if (earliest)
+    update_timeout();
+  return true;
+}
+
 } // namespace detail
 } // namespace asio
 } // namespace boost
@@ -39,6 +39,10 @@ public:
   // The number of bytes transferred, to be passed to the completion handler.
   std::size_t bytes_transferred_;
 
+  // The flags from the completion queue entry, e.g. to identify a buffer
+  // selected by the kernel from a provided buffer ring.
+  unsigned cqe_flags_;
+
   // The operation key used for targeted cancellation.
   void* cancellation_key_;
 
@@ -64,6 +68,7 @@ protected:
     : operation(complete_func),
       ec_(success_ec),
       bytes_transferred_(0),
+      cqe_flags_(0),
       cancellation_key_(0),
       prepare_func_(prepare_func),
       perform_func_(perform_func)
@@ -20,6 +20,7 @@
 #if defined(BOOST_ASIO_HAS_IO_URING)
 
 #include <liburing.h>
+#include <vector>
 #include <boost/asio/detail/atomic_count.hpp>
 #include <boost/asio/detail/buffer_sequence_adapter.hpp>
 #include <boost/asio/detail/conditionally_enabled_mutex.hpp>
@@ -49,7 +50,13 @@ private:
   typedef conditionally_enabled_mutex mutex;
 
 public:
-  enum op_types { read_op = 0, write_op = 1, except_op = 2, max_ops = 3 };
+  enum op_types { read_op = 0, write_op = 1, except_op = 2,
+    multishot_op = 3, max_ops = 4 };
+
+  // Function used to release the resources associated with a multishot result
+  // that was never consumed by an operation.
+  typedef void (*multishot_discard_func_type)(
+      void* context, int result, unsigned flags);
 
   class io_object;
 
@@ -58,13 +65,47 @@ public:
   {
     friend class io_uring_service;
 
+    // A completion received from a multishot operation.
+    struct multishot_result
+    {
+      int result_;
+      unsigned flags_;
+    };
+
     io_object* io_object_;
     op_queue<io_uring_operation> op_queue_;
     bool cancel_requested_;
 
+    // Whether the submission queue entry for the queue is linked to the entry
+    // of another queue, so that it may be cancelled if that entry fails.
+    bool linked_;
+    unsigned cqe_flags_;
+
+    // Whether a multishot submission queue entry is active for the queue.
+    bool multishot_armed_;
+
+    // Whether the queue has been posted to process multishot results.
+    bool multishot_posted_;
+
+    // Multishot results not yet consumed by an operation.
+    std::vector<multishot_result> multishot_results_;
+    std::size_t multishot_head_;
+
+    // Releases any multishot results that are never consumed.
+    multishot_discard_func_type multishot_discard_;
+    void* multishot_discard_context_;
+
     BOOST_ASIO_DECL io_queue();
-    void set_result(int r) { task_result_ = static_cast<unsigned>(r); }
+    void set_result(int r, unsigned flags)
+    {
+      task_result_ = static_cast<unsigned>(r);
+      cqe_flags_ = flags;
+    }
+    BOOST_ASIO_DECL bool push_multishot_result(int result, unsigned flags);
+    BOOST_ASIO_DECL bool pop_multishot_result(io_uring_operation* op);
+    BOOST_ASIO_DECL void discard_multishot_results();
     BOOST_ASIO_DECL operation* perform_io(int result);
+    BOOST_ASIO_DECL operation* perform_multishot_io();
     BOOST_ASIO_DECL static void do_complete(void* owner, operation* base,
         const boost::system::error_code& ec, std::size_t bytes_transferred);
   };
@@ -80,6 +121,11 @@ public:
     io_queue queues_[max_ops];
     bool shutdown_;
 
+    // The descriptor associated with the object, and the index of its entry
+    // in the ring's fixed file table, or -1 if it has no entry.
+    int descriptor_;
+    int file_index_;
+
     BOOST_ASIO_DECL io_object(bool locking, int spin_count);
   };
 
@@ -102,8 +148,11 @@ public:
   // Initialise the task.
   BOOST_ASIO_DECL void init_task();
 
-  // Register an I/O object with io_uring.
-  BOOST_ASIO_DECL void register_io_object(io_object*& io_obj);
+  // Register an I/O object with io_uring. If the fixed file table is enabled
+  // and has a free entry, the descriptor is added to the table and operations
+  // on the object refer to the descriptor using its index.
+  BOOST_ASIO_DECL void register_io_object(
+      io_object*& io_obj, int descriptor = -1);
 
   // Register an internal I/O object with io_uring.
   BOOST_ASIO_DECL void register_internal_io_object(
@@ -115,6 +164,26 @@ public:
   // Unregister buffers from io_uring.
   BOOST_ASIO_DECL void unregister_buffers();
 
+  // Register a ring of provided buffers with io_uring, and make all of the
+  // buffers available to the kernel. Returns the buffer group identifier.
+  BOOST_ASIO_DECL int register_buffer_ring(::io_uring_buf_ring*& ring,
+      void* data, unsigned count, std::size_t size);
+
+  // Unregister a ring of provided buffers from io_uring.
+  BOOST_ASIO_DECL void unregister_buffer_ring(
+      ::io_uring_buf_ring* ring, unsigned count, int group_id);
+
+  // Return a buffer to a ring of provided buffers. Calls for the same ring
+  // must not be made concurrently.
+  static void recycle_buffer(::io_uring_buf_ring* ring,
+      unsigned count, void* data, std::size_t size, int id)
+  {
+    ::io_uring_buf_ring_add(ring, data, static_cast<unsigned>(size),
+        static_cast<unsigned short>(id),
+        ::io_uring_buf_ring_mask(count), 0);
+    ::io_uring_buf_ring_advance(ring, 1);
+  }
+
   // Post an operation for immediate completion.
   void post_immediate_completion(operation* op, bool is_continuation);
 
@@ -123,6 +192,25 @@ public:
   BOOST_ASIO_DECL void start_op(int op_type, per_io_object_data& io_obj,
       io_uring_operation* op, bool is_continuation);
 
+  // Start two operations on the same I/O object as a linked chain, so that the
+  // second operation is submitted only after the first has completed, and is
+  // cancelled if the first fails. The operations are started separately if
+  // either queue already has operations waiting.
+  BOOST_ASIO_DECL void start_linked_ops(per_io_object_data& io_obj,
+      int op_type1, io_uring_operation* op1, int op_type2,
+      io_uring_operation* op2, bool is_continuation);
+
+  // Start a new multishot operation. The operation is completed using the next
+  // result from the I/O object's multishot submission queue entry, which is
+  // prepared from the operation and armed if it is not already active.
+  // Results that are received while no operation is waiting are retained for
+  // subsequent operations, and are released using the specified discard
+  // function if they are never consumed. The discard context must be the same
+  // for all operations sharing the multishot submission queue entry.
+  BOOST_ASIO_DECL void start_multishot_op(per_io_object_data& io_obj,
+      io_uring_operation* op, multishot_discard_func_type discard,
+      void* discard_context, bool is_continuation);
+
   // Cancel all operations associated with the given I/O object. The handlers
   // associated with the I/O object will be invoked with the operation_aborted
   // error.
@@ -178,6 +266,26 @@ public:
       typename timer_queue<TimeTraits, Allocator>::per_timer_data& target,
       typename timer_queue<TimeTraits, Allocator>::per_timer_data& source);
 
+  // Change the expiry time of the timer operations associated with the given
+  // timer, without cancelling them.
+  template <typename TimeTraits, typename Allocator>
+  void reschedule_timer(timer_queue<TimeTraits, Allocator>& queue,
+      const typename TimeTraits::time_type& time,
+      typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer);
+
+  // Schedule a periodic operation associated with the given timer, cancelling
+  // any periodic operation that is already associated with the timer.
+  template <typename TimeTraits, typename Allocator>
+  void schedule_periodic_timer(timer_queue<TimeTraits, Allocator>& queue,
+      typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer,
+      typename timer_queue<TimeTraits, Allocator>::periodic_op* op);
+
+  // Schedule a periodic operation that has completed to expire again. Returns
+  // false if the scheduler has been shut down.
+  template <typename TimeTraits, typename Allocator>
+  bool requeue_periodic_timer(timer_queue<TimeTraits, Allocator>& queue,
+      typename timer_queue<TimeTraits, Allocator>::periodic_op* op);
+
   // Wait on io_uring once until interrupted or events are ready to be
   // dispatched.
   BOOST_ASIO_DECL void run(long usec, op_queue<operation>& ops);
@@ -195,6 +303,10 @@ private:
   // The number of operations to complete in a batch.
   enum { complete_batch_size = 128 };
 
+  // The number of unconsumed multishot results at which a multishot
+  // operation is cancelled, to be rearmed once the results are consumed.
+  enum { multishot_backlog_limit = 128 };
+
   // The type used for processing eventfd readiness notifications.
   class event_fd_read_op;
 
@@ -204,18 +316,59 @@ private:
   // Register the eventfd descriptor for readiness notifications.
   BOOST_ASIO_DECL void register_with_reactor();
 
+  // Signal the eventfd descriptor to interrupt a single issuer ring's thread.
+  BOOST_ASIO_DECL void signal_event_fd();
+
+  // Enable a single issuer ring, if required, and submit any submission queue
+  // entries that were added by other threads. Called by the issuing thread.
+  BOOST_ASIO_DECL void submit_as_issuer();
+
   // Allocate a new I/O object.
   BOOST_ASIO_DECL io_object* allocate_io_object();
 
   // Free an existing I/O object.
   BOOST_ASIO_DECL void free_io_object(io_object* s);
 
+  // Add a descriptor to the fixed file table. Returns the index of the new
+  // entry, or -1 if the descriptor could not be added.
+  BOOST_ASIO_DECL int register_file(int descriptor);
+
+  // Remove an I/O object's descriptor from the fixed file table. The entry is
+  // not reused until the I/O object is freed. This function must be called
+  // while the I/O object's mutex is held.
+  BOOST_ASIO_DECL void unregister_file(io_object* io_obj);
+
+  // Helper function to make a prepared submission queue entry refer to the
+  // I/O object's descriptor using its fixed file table index.
+  void use_fixed_file(io_object* io_obj, ::io_uring_sqe* sqe)
+  {
+    if (io_obj->file_index_ >= 0 && io_obj->service_ == this
+        && io_obj->descriptor_ >= 0 && sqe->fd == io_obj->descriptor_)
+    {
+      sqe->fd = io_obj->file_index_;
+      sqe->flags |= IOSQE_FIXED_FILE;
+    }
+  }
+
   // Helper function to cancel all operations associated with the given I/O
   // object. This function must be called while the I/O object's mutex is held.
   // Returns true if there are operations for which cancellation is pending.
   BOOST_ASIO_DECL bool do_cancel_ops(
       per_io_object_data& io_obj, op_queue<operation>& ops);
 
+  // Helper function to arm the multishot submission queue entry for the
+  // operation at the head of the I/O queue. This function must be called
+  // while the I/O object's mutex is held. Returns false if no submission queue
+  // entry was available.
+  BOOST_ASIO_DECL bool arm_multishot_op(io_queue& io_q);
+
+  // Determine whether a completion queue entry is the last one that will be
+  // produced for its submission queue entry.
+  static bool is_final_cqe(const ::io_uring_cqe* cqe)
+  {
+    return (cqe->flags & IORING_CQE_F_MORE) == 0;
+  }
+
   // Helper function to add a new timer queue.
   BOOST_ASIO_DECL void do_add_timer_queue(timer_queue_base& queue);
 
@@ -228,6 +381,11 @@ private:
   // Get the current timeout value.
   BOOST_ASIO_DECL __kernel_timespec get_timeout() const;
 
+  // Get the time, in microseconds of the monotonic clock, at which a timeout
+  // with the specified relative value will expire if it is started now.
+  BOOST_ASIO_DECL static long long get_timeout_expiry(
+      const __kernel_timespec& ts);
+
   // Get a new submission queue entry, flushing the queue if necessary.
   BOOST_ASIO_DECL ::io_uring_sqe* get_sqe();
 
@@ -282,6 +440,23 @@ private:
   // How any times to spin waiting for the I/O mutex.
   const int io_locking_spin_count_;
 
+  // The flags used to set up the ring.
+  const unsigned int setup_flags_;
+
+  // The time, in milliseconds, that the kernel's submission queue polling
+  // thread may be idle before it sleeps.
+  const unsigned int sqpoll_idle_;
+
+  // The CPU to which the submission queue polling thread is bound, or -1.
+  const int sqpoll_cpu_;
+
+  // Whether submissions must be made from a single thread.
+  bool single_issuer_;
+
+  // Whether the ring has been enabled. A single issuer ring is created in a
+  // disabled state and enabled by the first thread to run it.
+  bool ring_enabled_;
+
   // The timer queues.
   timer_queue_set timer_queues_;
 
@@ -289,6 +464,21 @@ private:
   // operation is outstanding.
   __kernel_timespec timeout_;
 
+  // The time at which the pending timeout operation will expire.
+  long long timeout_expiry_;
+
+  // The timespec for the pending timeout update operation. Must remain valid
+  // while the operation is outstanding.
+  __kernel_timespec timeout_update_;
+
+  // Whether a timeout update operation is outstanding. Changes to the earliest
+  // timer are coalesced until it completes.
+  bool timeout_update_pending_;
+
+  // Whether the pending timeout may be updated in place. Otherwise it is
+  // removed and restarted.
+  bool timeout_update_supported_;
+
   // Mutex to protect access to the registered I/O objects.
   mutex registration_mutex_;
 
@@ -306,8 +496,25 @@ private:
   // The per-descriptor reactor data used for the eventfd.
   reactor::per_descriptor_data reactor_data_;
 
-  // The eventfd descriptor used to wait for readiness.
+  // The eventfd descriptor used to wait for readiness or, for a single
+  // issuer ring, to interrupt the issuing thread.
   int event_fd_;
+
+  // The internal I/O object used to wait on the eventfd descriptor.
+  per_io_object_data event_fd_io_object_;
+
+  // The next unused buffer group identifier for provided buffer rings.
+  int next_buffer_group_;
+
+  // Buffer group identifiers that have been released for reuse.
+  std::vector<int> free_buffer_groups_;
+
+  // The descriptors in the fixed file table, with -1 for unused entries. The
+  // table is disabled if empty. Protected by mutex_.
+  std::vector<int> registered_files_;
+
+  // Fixed file table entries that are available for reuse.
+  std::vector<int> free_files_;
 };
 
 } // namespace detail
@@ -60,7 +60,13 @@ public:
     io_uring_socket_accept_op_base* o(
         static_cast<io_uring_socket_accept_op_base*>(base));
 
-    if ((o->state_ & socket_ops::internal_non_blocking) != 0)
+    if ((o->state_ & socket_ops::multishot_accept) != 0)
+    {
+      // The peer address is obtained separately for each accepted socket, as
+      // there is only one address buffer for all multishot completions.
+      ::io_uring_prep_multishot_accept(sqe, o->socket_, 0, 0, 0);
+    }
+    else if ((o->state_ & socket_ops::internal_non_blocking) != 0)
     {
       ::io_uring_prep_poll_add(sqe, o->socket_, POLLIN);
     }
@@ -78,6 +84,13 @@ public:
     io_uring_socket_accept_op_base* o(
         static_cast<io_uring_socket_accept_op_base*>(base));
 
+    if ((o->state_ & socket_ops::multishot_accept) != 0)
+    {
+      if (after_completion && !o->ec_)
+        o->new_socket_.reset(static_cast<int>(o->bytes_transferred_));
+      return after_completion;
+    }
+
     if ((o->state_ & socket_ops::internal_non_blocking) != 0)
     {
       socket_type new_socket = invalid_socket;
@@ -106,6 +119,15 @@ public:
   {
     if (new_socket_.get() != invalid_socket)
     {
+      if (peer_endpoint_ && (state_ & socket_ops::multishot_accept) != 0)
+      {
+        std::size_t addrlen = peer_endpoint_->capacity();
+        socket_ops::getpeername(new_socket_.get(),
+            peer_endpoint_->data(), &addrlen, false, ec_);
+        if (ec_)
+          return;
+        addrlen_ = static_cast<socklen_t>(addrlen);
+      }
       if (peer_endpoint_)
         peer_endpoint_->resize(addrlen_);
       peer_.assign(protocol_, new_socket_.get(), ec_);
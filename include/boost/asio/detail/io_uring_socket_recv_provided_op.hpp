@@ -0,0 +1,225 @@
+//
+// detail/io_uring_socket_recv_provided_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_IO_URING_SOCKET_RECV_PROVIDED_OP_HPP
+#define BOOST_ASIO_DETAIL_IO_URING_SOCKET_RECV_PROVIDED_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+
+#include <boost/asio/detail/bind_handler.hpp>
+#include <boost/asio/detail/socket_ops.hpp>
+#include <boost/asio/detail/fenced_block.hpp>
+#include <boost/asio/detail/handler_work.hpp>
+#include <boost/asio/detail/io_uring_operation.hpp>
+#include <boost/asio/detail/memory.hpp>
+#include <boost/asio/provided_buffer_ring.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+class io_uring_socket_recv_provided_op_base : public io_uring_operation
+{
+public:
+  io_uring_socket_recv_provided_op_base(
+      const boost::system::error_code& success_ec, socket_type socket,
+      socket_ops::state_type state, provided_buffer_ring_base& ring,
+      socket_base::message_flags flags, func_type complete_func)
+    : io_uring_operation(success_ec,
+        &io_uring_socket_recv_provided_op_base::do_prepare,
+        &io_uring_socket_recv_provided_op_base::do_perform, complete_func),
+      socket_(socket),
+      state_(state),
+      ring_(ring),
+      flags_(flags),
+      poll_first_(false),
+      buffer_()
+  {
+  }
+
+  static void do_prepare(io_uring_operation* base, ::io_uring_sqe* sqe)
+  {
+    BOOST_ASIO_ASSUME(base != 0);
+    io_uring_socket_recv_provided_op_base* o(
+        static_cast<io_uring_socket_recv_provided_op_base*>(base));
+
+    if ((o->state_ & socket_ops::multishot_receive) != 0)
+    {
+      // One submission queue entry produces a completion, each with its own
+      // selected buffer, for every receive until it is cancelled.
+      ::io_uring_prep_recv_multishot(sqe, o->socket_, 0, 0, o->flags_);
+      sqe->flags |= IOSQE_BUFFER_SELECT;
+      sqe->buf_group = static_cast<__u16>(o->ring_.group_id());
+    }
+    else if (o->poll_first_)
+    {
+      bool except_op = (o->flags_ & socket_base::message_out_of_band) != 0;
+      ::io_uring_prep_poll_add(sqe, o->socket_, except_op ? POLLPRI : POLLIN);
+    }
+    else
+    {
+      // The kernel selects a buffer from the ring once data is available.
+      ::io_uring_prep_recv(sqe, o->socket_, 0,
+          o->ring_.buffer_size(), o->flags_);
+      sqe->flags |= IOSQE_BUFFER_SELECT;
+      sqe->buf_group = static_cast<__u16>(o->ring_.group_id());
+    }
+  }
+
+  static bool do_perform(io_uring_operation* base, bool after_completion)
+  {
+    BOOST_ASIO_ASSUME(base != 0);
+    io_uring_socket_recv_provided_op_base* o(
+        static_cast<io_uring_socket_recv_provided_op_base*>(base));
+
+    // A buffer can only be selected by the kernel, so there is no speculative
+    // attempt to perform the operation.
+    if (!after_completion)
+      return false;
+
+    if (o->poll_first_ && (o->state_ & socket_ops::multishot_receive) == 0)
+    {
+      // The socket is ready, so submit the receive.
+      o->poll_first_ = false;
+      return !!o->ec_;
+    }
+
+    int id = -1;
+    if ((o->cqe_flags_ & IORING_CQE_F_BUFFER) != 0)
+      id = static_cast<int>(o->cqe_flags_ >> IORING_CQE_BUFFER_SHIFT);
+
+    if (o->ec_ && o->ec_ == boost::asio::error::would_block
+        && (o->state_ & socket_ops::multishot_receive) == 0)
+    {
+      // The socket is in non-blocking mode, so wait for readiness.
+      if (id >= 0)
+        o->ring_.recycle_buffer(id);
+      o->poll_first_ = true;
+      return false;
+    }
+
+    if (!o->ec_ && o->bytes_transferred_ == 0)
+      if ((o->state_ & socket_ops::stream_oriented) != 0)
+        o->ec_ = boost::asio::error::eof;
+
+    if (id >= 0)
+    {
+      if (o->ec_)
+        o->ring_.recycle_buffer(id);
+      else
+        o->buffer_ = o->ring_.make_buffer(id, o->bytes_transferred_);
+    }
+
+    return true;
+  }
+
+  // Return a buffer to the ring if it was selected for a multishot result that
+  // is not consumed by any operation.
+  static void discard_result(void* context, int /*result*/, unsigned flags)
+  {
+    if ((flags & IORING_CQE_F_BUFFER) != 0)
+    {
+      static_cast<provided_buffer_ring_base*>(context)->recycle_buffer(
+          static_cast<int>(flags >> IORING_CQE_BUFFER_SHIFT));
+    }
+  }
+
+private:
+  socket_type socket_;
+  socket_ops::state_type state_;
+  provided_buffer_ring_base& ring_;
+  socket_base::message_flags flags_;
+  bool poll_first_;
+
+protected:
+  provided_buffer buffer_;
+};
+
+template <typename Handler, typename IoExecutor>
+class io_uring_socket_recv_provided_op
+  : public io_uring_socket_recv_provided_op_base
+{
+public:
+  BOOST_ASIO_DEFINE_HANDLER_PTR(io_uring_socket_recv_provided_op);
+
+  io_uring_socket_recv_provided_op(
+      const boost::system::error_code& success_ec, int socket,
+      socket_ops::state_type state, provided_buffer_ring_base& ring,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+    : io_uring_socket_recv_provided_op_base(success_ec, socket, state,
+        ring, flags, &io_uring_socket_recv_provided_op::do_complete),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const boost::system::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    BOOST_ASIO_ASSUME(base != 0);
+    io_uring_socket_recv_provided_op* o
+      (static_cast<io_uring_socket_recv_provided_op*>(base));
+    ptr p = { boost::asio::detail::addressof(o->handler_), o, o };
+
+    BOOST_ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    BOOST_ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, boost::system::error_code, provided_buffer>
+      handler(o->handler_, o->ec_, o->buffer_);
+    p.h = boost::asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      BOOST_ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      BOOST_ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+
+#endif // BOOST_ASIO_DETAIL_IO_URING_SOCKET_RECV_PROVIDED_OP_HPP
@@ -0,0 +1,181 @@
+//
+// detail/io_uring_socket_recvfrom_many_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_IO_URING_SOCKET_RECVFROM_MANY_OP_HPP
+#define BOOST_ASIO_DETAIL_IO_URING_SOCKET_RECVFROM_MANY_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_IO_URING)
+
+#include <boost/asio/detail/bind_handler.hpp>
+#include <boost/asio/detail/socket_ops.hpp>
+#include <boost/asio/detail/fenced_block.hpp>
+#include <boost/asio/detail/handler_work.hpp>
+#include <boost/asio/detail/io_uring_operation.hpp>
+#include <boost/asio/detail/memory.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+template <typename Slot>
+class io_uring_socket_recvfrom_many_op_base : public io_uring_operation
+{
+public:
+  io_uring_socket_recvfrom_many_op_base(
+      const boost::system::error_code& success_ec, socket_type socket,
+      Slot* slots, std::size_t count, socket_base::message_flags flags,
+      func_type complete_func)
+    : io_uring_operation(success_ec,
+        &io_uring_socket_recvfrom_many_op_base::do_prepare,
+        &io_uring_socket_recvfrom_many_op_base::do_perform, complete_func),
+      socket_(socket),
+      slots_(slots),
+      count_(count),
+      flags_(flags)
+  {
+  }
+
+  static void do_prepare(io_uring_operation* base, ::io_uring_sqe* sqe)
+  {
+    BOOST_ASIO_ASSUME(base != 0);
+    io_uring_socket_recvfrom_many_op_base* o(
+        static_cast<io_uring_socket_recvfrom_many_op_base*>(base));
+
+    // The whole batch is transferred by a single system call once the socket
+    // is ready, rather than by one submission queue entry per datagram.
+    ::io_uring_prep_poll_add(sqe, o->socket_, POLLIN);
+  }
+
+  static bool do_perform(io_uring_operation* base, bool after_completion)
+  {
+    BOOST_ASIO_ASSUME(base != 0);
+    io_uring_socket_recvfrom_many_op_base* o(
+        static_cast<io_uring_socket_recvfrom_many_op_base*>(base));
+
+    // The wait for readiness failed or was cancelled.
+    if (after_completion && o->ec_)
+      return true;
+
+    socket_ops::batched_datagram msgs[socket_ops::max_batched_datagrams];
+    std::size_t count = o->count_;
+    if (count > socket_ops::max_batched_datagrams)
+      count = socket_ops::max_batched_datagrams;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      msgs[i].data = o->slots_[i].buffer().data();
+      msgs[i].size = o->slots_[i].buffer().size();
+      msgs[i].addr = o->slots_[i].endpoint().data();
+      msgs[i].addrlen = o->slots_[i].endpoint().capacity();
+    }
+
+    if (!socket_ops::non_blocking_recvmmsg(o->socket_, msgs, count,
+          o->flags_ | MSG_DONTWAIT, o->ec_, o->bytes_transferred_))
+      return false;
+
+    if (!o->ec_)
+    {
+      for (std::size_t i = 0; i < o->bytes_transferred_; ++i)
+      {
+        o->slots_[i].endpoint().resize(msgs[i].addrlen);
+        o->slots_[i].bytes_transferred(msgs[i].bytes_transferred);
+      }
+    }
+
+    return true;
+  }
+
+private:
+  socket_type socket_;
+  Slot* slots_;
+  std::size_t count_;
+  socket_base::message_flags flags_;
+};
+
+template <typename Slot, typename Handler, typename IoExecutor>
+class io_uring_socket_recvfrom_many_op
+  : public io_uring_socket_recvfrom_many_op_base<Slot>
+{
+public:
+  BOOST_ASIO_DEFINE_HANDLER_PTR(io_uring_socket_recvfrom_many_op);
+
+  io_uring_socket_recvfrom_many_op(const boost::system::error_code& success_ec,
+      socket_type socket, Slot* slots, std::size_t count,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+    : io_uring_socket_recvfrom_many_op_base<Slot>(success_ec,
+        socket, slots, count, flags,
+        &io_uring_socket_recvfrom_many_op::do_complete),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const boost::system::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    BOOST_ASIO_ASSUME(base != 0);
+    io_uring_socket_recvfrom_many_op* o
+      (static_cast<io_uring_socket_recvfrom_many_op*>(base));
+    ptr p = { boost::asio::detail::addressof(o->handler_), o, o };
+
+    BOOST_ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    BOOST_ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, boost::system::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = boost::asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      BOOST_ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      BOOST_ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
+#endif // BOOST_ASIO_DETAIL_IO_URING_SOCKET_RECVFROM_MANY_OP_HPP
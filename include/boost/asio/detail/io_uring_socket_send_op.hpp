@@ -65,6 +65,21 @@ public:
     {
       ::io_uring_prep_poll_add(sqe, o->socket_, POLLOUT);
     }
+    else if ((o->state_ & socket_ops::zero_copy_send) != 0)
+    {
+      // The operation completes only once the kernel has released the
+      // buffers, which is signalled by a separate notification completion.
+      if (o->bufs_.is_single_buffer)
+      {
+        ::io_uring_prep_send_zc(sqe, o->socket_,
+            o->bufs_.buffers()->iov_base, o->bufs_.buffers()->iov_len,
+            o->flags_, 0);
+      }
+      else
+      {
+        ::io_uring_prep_sendmsg_zc(sqe, o->socket_, &o->msghdr_, o->flags_);
+      }
+    }
     else if (o->bufs_.is_single_buffer
         && o->bufs_.is_registered_buffer && o->flags_ == 0)
     {
@@ -110,6 +125,22 @@ public:
     return after_completion;
   }
 
+  // Whether an operation with the specified state and flags is performed by a
+  // single send that may transfer fewer bytes than requested without failing,
+  // so that it does not break a chain of linked operations unless an error
+  // occurs.
+  static bool is_linkable(socket_ops::state_type state,
+      socket_base::message_flags flags)
+  {
+    typedef buffer_sequence_adapter<boost::asio::const_buffer,
+        ConstBufferSequence> bufs_type;
+
+    return (state & (socket_ops::internal_non_blocking
+          | socket_ops::zero_copy_send)) == 0
+      && !(bufs_type::is_single_buffer
+        && bufs_type::is_registered_buffer && flags == 0);
+  }
+
 private:
   socket_type socket_;
   socket_ops::state_type state_;
@@ -0,0 +1,247 @@
+//
+// detail/io_uring_socket_send_recv_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_IO_URING_SOCKET_SEND_RECV_OP_HPP
+#define BOOST_ASIO_DETAIL_IO_URING_SOCKET_SEND_RECV_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_IO_URING)
+
+#include <boost/asio/detail/atomic_count.hpp>
+#include <boost/asio/detail/bind_handler.hpp>
+#include <boost/asio/detail/fenced_block.hpp>
+#include <boost/asio/detail/handler_work.hpp>
+#include <boost/asio/detail/io_uring_socket_recv_op.hpp>
+#include <boost/asio/detail/io_uring_socket_send_op.hpp>
+#include <boost/asio/detail/memory.hpp>
+#include <boost/asio/detail/socket_send_then_receive_op.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// A send operation and a receive operation that complete a single handler.
+// The operations are queued and completed independently, and the handler is
+// invoked once both have completed.
+//
+// The send is submitted with MSG_WAITALL, so that the kernel retries a short
+// send and breaks the link if all of the data cannot be sent. Kernels that do
+// not support MSG_WAITALL for sends complete a short send normally, and the
+// linked receive is then cancelled explicitly. In both cases the remaining
+// data is sent, and the receive restarted, by a composed operation.
+template <typename Service, typename Implementation,
+    typename ConstBufferSequence, typename MutableBufferSequence,
+    typename Handler, typename IoExecutor>
+class io_uring_socket_send_recv_op
+{
+public:
+  BOOST_ASIO_DEFINE_HANDLER_PTR(io_uring_socket_send_recv_op);
+
+  io_uring_socket_send_recv_op(const boost::system::error_code& success_ec,
+      Service& service, Implementation& impl,
+      const ConstBufferSequence& send_buffers,
+      const MutableBufferSequence& receive_buffers,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+    : send_op_(this, success_ec, impl.socket_, impl.state_,
+        send_buffers, flags | MSG_WAITALL),
+      receive_op_(this, success_ec, impl.socket_, impl.state_,
+        receive_buffers, flags),
+      service_(service),
+      impl_(impl),
+      send_buffers_(send_buffers),
+      send_size_(boost::asio::buffer_size(send_buffers)),
+      receive_buffers_(receive_buffers),
+      flags_(flags),
+      outstanding_ops_(2),
+      handler_(static_cast<Handler&&>(handler)),
+      io_ex_(io_ex),
+      work_(handler_, io_ex)
+  {
+    receive_op_.cancellation_key_ = this;
+  }
+
+  io_uring_operation* send_op()
+  {
+    return &send_op_;
+  }
+
+  io_uring_operation* receive_op()
+  {
+    return &receive_op_;
+  }
+
+private:
+  class send_op_type
+    : public io_uring_socket_send_op_base<ConstBufferSequence>
+  {
+  public:
+    send_op_type(io_uring_socket_send_recv_op* owner,
+        const boost::system::error_code& success_ec, int socket,
+        socket_ops::state_type state, const ConstBufferSequence& buffers,
+        socket_base::message_flags flags)
+      : io_uring_socket_send_op_base<ConstBufferSequence>(success_ec,
+          socket, state, buffers, flags, &send_op_type::do_complete),
+        owner_(owner)
+    {
+    }
+
+    static void do_complete(void* owner, operation* base,
+        const boost::system::error_code& /*ec*/,
+        std::size_t /*bytes_transferred*/)
+    {
+      BOOST_ASIO_ASSUME(base != 0);
+      send_op_type* o(static_cast<send_op_type*>(base));
+
+      // A short send that did not break the link leaves the receive pending,
+      // but the peer may be waiting for the rest of the data.
+      if (owner && !o->ec_ && o->bytes_transferred_ < o->owner_->send_size_)
+      {
+        o->owner_->service_.cancel_receive_by_key(o->owner_->impl_,
+            o->owner_->receive_op_.cancellation_key_);
+      }
+
+      io_uring_socket_send_recv_op::do_complete(owner, o->owner_);
+    }
+
+  private:
+    io_uring_socket_send_recv_op* owner_;
+  };
+
+  class receive_op_type
+    : public io_uring_socket_recv_op_base<MutableBufferSequence>
+  {
+  public:
+    receive_op_type(io_uring_socket_send_recv_op* owner,
+        const boost::system::error_code& success_ec, int socket,
+        socket_ops::state_type state, const MutableBufferSequence& buffers,
+        socket_base::message_flags flags)
+      : io_uring_socket_recv_op_base<MutableBufferSequence>(success_ec,
+          socket, state, buffers, flags, &receive_op_type::do_complete),
+        owner_(owner)
+    {
+    }
+
+    static void do_complete(void* owner, operation* base,
+        const boost::system::error_code& /*ec*/,
+        std::size_t /*bytes_transferred*/)
+    {
+      BOOST_ASIO_ASSUME(base != 0);
+      io_uring_socket_send_recv_op::do_complete(
+          owner, static_cast<receive_op_type*>(base)->owner_);
+    }
+
+  private:
+    io_uring_socket_send_recv_op* owner_;
+  };
+
+  static void do_complete(void* owner, io_uring_socket_send_recv_op* o)
+  {
+    // The handler is invoked, or destroyed, by the last operation to complete.
+    if (!ref_count_down(o->outstanding_ops_))
+      return;
+
+    // Take ownership of the handler object.
+    ptr p = { boost::asio::detail::addressof(o->handler_), o, o };
+
+    BOOST_ASIO_HANDLER_COMPLETION((o->send_op_));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    // After a short send the receive has been cancelled. Send the remaining
+    // data, and then receive, as if the operations had not been linked.
+    if (owner && !o->send_op_.ec_
+        && o->send_op_.bytes_transferred_ < o->send_size_
+        && o->receive_op_.ec_ == boost::asio::error::operation_aborted)
+    {
+      typedef socket_send_then_receive_op<Service, Implementation,
+          ConstBufferSequence, MutableBufferSequence, Handler, IoExecutor>
+        continuation_type;
+
+      detail::binder2<continuation_type, boost::system::error_code,
+        std::size_t> handler(0, continuation_type(o->service_, o->impl_,
+            o->send_buffers_, o->receive_buffers_, o->flags_, o->handler_,
+            o->io_ex_), o->send_op_.ec_, o->send_op_.bytes_transferred_);
+      p.h = boost::asio::detail::addressof(handler.handler_.handler_);
+      p.reset();
+
+      fenced_block b(fenced_block::half);
+      w.complete(handler, handler.handler_.handler_);
+      return;
+    }
+
+    // The error is taken from the first operation that failed. If the send
+    // fails then a linked receive is cancelled.
+    boost::system::error_code ec = o->send_op_.ec_;
+    std::size_t bytes_received = 0;
+    if (!ec)
+    {
+      ec = o->receive_op_.ec_;
+      bytes_received = o->receive_op_.bytes_transferred_;
+    }
+
+    BOOST_ASIO_ERROR_LOCATION(ec);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder3<Handler, boost::system::error_code, std::size_t,
+      std::size_t> handler(o->handler_, ec,
+        o->send_op_.bytes_transferred_, bytes_received);
+    p.h = boost::asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      BOOST_ASIO_HANDLER_INVOCATION_BEGIN((
+            handler.arg1_, handler.arg2_, handler.arg3_));
+      w.complete(handler, handler.handler_);
+      BOOST_ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+  send_op_type send_op_;
+  receive_op_type receive_op_;
+  Service& service_;
+  Implementation& impl_;
+  ConstBufferSequence send_buffers_;
+  std::size_t send_size_;
+  MutableBufferSequence receive_buffers_;
+  socket_base::message_flags flags_;
+  atomic_count outstanding_ops_;
+  Handler handler_;
+  IoExecutor io_ex_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
+#endif // BOOST_ASIO_DETAIL_IO_URING_SOCKET_SEND_RECV_OP_HPP
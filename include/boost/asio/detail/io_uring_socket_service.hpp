@@ -20,6 +20,7 @@
 #if defined(BOOST_ASIO_HAS_IO_URING)
 
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/datagram_slot.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/execution_context.hpp>
 #include <boost/asio/socket_base.hpp>
@@ -30,8 +31,12 @@
 #include <boost/asio/detail/io_uring_service.hpp>
 #include <boost/asio/detail/io_uring_socket_accept_op.hpp>
 #include <boost/asio/detail/io_uring_socket_connect_op.hpp>
+#include <boost/asio/detail/io_uring_socket_recvfrom_coalesced_op.hpp>
+#include <boost/asio/detail/io_uring_socket_recvfrom_many_op.hpp>
 #include <boost/asio/detail/io_uring_socket_recvfrom_op.hpp>
+#include <boost/asio/detail/io_uring_socket_sendto_many_op.hpp>
 #include <boost/asio/detail/io_uring_socket_sendto_op.hpp>
+#include <boost/asio/detail/io_uring_socket_sendto_segmented_op.hpp>
 #include <boost/asio/detail/io_uring_socket_service_base.hpp>
 #include <boost/asio/detail/socket_holder.hpp>
 #include <boost/asio/detail/socket_ops.hpp>
@@ -474,6 +479,162 @@ public:
     p.v = p.p = 0;
   }
 
+  // Start an asynchronous send of a batch of datagrams, each to its own
+  // destination.
+  template <typename Handler, typename IoExecutor>
+  void async_send_to_many(implementation_type& impl,
+      datagram_slot<const_buffer, endpoint_type>* slots, std::size_t count,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      boost_asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = boost::asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_sendto_many_op<
+        datagram_slot<const_buffer, endpoint_type>, Handler, IoExecutor> op;
+    typename op::ptr p = { boost::asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        slots, count, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    BOOST_ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_send_to_many"));
+
+    start_op(impl, io_uring_service::write_op,
+        p.p, is_continuation, count == 0);
+    p.v = p.p = 0;
+  }
+
+  // Start an asynchronous receive of a batch of datagrams, recording the
+  // sender of each.
+  template <typename Handler, typename IoExecutor>
+  void async_receive_from_many(implementation_type& impl,
+      datagram_slot<mutable_buffer, endpoint_type>* slots, std::size_t count,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      boost_asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = boost::asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_recvfrom_many_op<
+        datagram_slot<mutable_buffer, endpoint_type>, Handler, IoExecutor> op;
+    typename op::ptr p = { boost::asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        slots, count, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::read_op);
+    }
+
+    BOOST_ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_receive_from_many"));
+
+    start_op(impl, io_uring_service::read_op,
+        p.p, is_continuation, count == 0);
+    p.v = p.p = 0;
+  }
+
+  // Start an asynchronous send of data that the kernel splits into datagrams
+  // of the specified segment size. The data being sent must be valid for the
+  // lifetime of the asynchronous operation.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_send_to_segmented(implementation_type& impl,
+      const ConstBufferSequence& buffers, const endpoint_type& destination,
+      std::size_t segment_size, socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      boost_asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = boost::asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_sendto_segmented_op<ConstBufferSequence,
+        endpoint_type, Handler, IoExecutor> op;
+    typename op::ptr p = { boost::asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
+        buffers, destination, segment_size, flags, handler, io_ex);
+
+    // Segment sizes that cannot be honoured fail without being submitted.
+    bool noop = !socket_ops::check_segment_size(segment_size, p.p->ec_);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    BOOST_ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_send_to_segmented"));
+
+    start_op(impl, io_uring_service::write_op, p.p, is_continuation, noop);
+    p.v = p.p = 0;
+  }
+
+  // Start an asynchronous receive of data that the kernel may have coalesced
+  // from several datagrams. The buffers, sender_endpoint and segment_size
+  // must all be valid for the lifetime of the asynchronous operation.
+  template <typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_receive_from_coalesced(implementation_type& impl,
+      const MutableBufferSequence& buffers, endpoint_type& sender_endpoint,
+      std::size_t& segment_size, socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      boost_asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = boost::asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_recvfrom_coalesced_op<MutableBufferSequence,
+        endpoint_type, Handler, IoExecutor> op;
+    typename op::ptr p = { boost::asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
+        buffers, sender_endpoint, segment_size, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::read_op);
+    }
+
+    BOOST_ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_receive_from_coalesced"));
+
+    start_op(impl, io_uring_service::read_op, p.p, is_continuation, false);
+    p.v = p.p = 0;
+  }
+
   // Accept a new connection.
   template <typename Socket>
   boost::system::error_code accept(implementation_type& impl,
@@ -530,7 +691,7 @@ public:
     {
       p.p->cancellation_key_ =
         &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
-            &impl.io_object_data_, io_uring_service::read_op);
+            &impl.io_object_data_, accept_op_type(impl));
     }
 
     BOOST_ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
@@ -566,7 +727,7 @@ public:
     {
       p.p->cancellation_key_ =
         &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
-            &impl.io_object_data_, io_uring_service::read_op);
+            &impl.io_object_data_, accept_op_type(impl));
     }
 
     BOOST_ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
@@ -30,11 +30,14 @@
 #include <boost/asio/detail/io_uring_null_buffers_op.hpp>
 #include <boost/asio/detail/io_uring_service.hpp>
 #include <boost/asio/detail/io_uring_socket_recv_op.hpp>
+#include <boost/asio/detail/io_uring_socket_recv_provided_op.hpp>
 #include <boost/asio/detail/io_uring_socket_recvmsg_op.hpp>
 #include <boost/asio/detail/io_uring_socket_send_op.hpp>
+#include <boost/asio/detail/io_uring_socket_send_recv_op.hpp>
 #include <boost/asio/detail/io_uring_wait_op.hpp>
 #include <boost/asio/detail/socket_holder.hpp>
 #include <boost/asio/detail/socket_ops.hpp>
+#include <boost/asio/detail/socket_send_then_receive_op.hpp>
 #include <boost/asio/detail/socket_types.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
@@ -427,6 +430,56 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  // Start an asynchronous receive into a buffer selected by the kernel from a
+  // ring of provided buffers. The ring must be valid for the lifetime of the
+  // asynchronous operation.
+  template <typename Handler, typename IoExecutor>
+  void async_receive(base_implementation_type& impl,
+      provided_buffer_ring_base& ring, socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      boost_asio_handler_cont_helpers::is_continuation(handler);
+
+    bool multishot = (impl.state_ & socket_ops::multishot_receive) != 0;
+    int op_type = multishot ? io_uring_service::multishot_op
+      : (flags & socket_base::message_out_of_band)
+        ? io_uring_service::except_op : io_uring_service::read_op;
+
+    associated_cancellation_slot_t<Handler> slot
+      = boost::asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_recv_provided_op<Handler, IoExecutor> op;
+    typename op::ptr p = { boost::asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        impl.state_, ring, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(
+            &io_uring_service_, &impl.io_object_data_, op_type);
+    }
+
+    BOOST_ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_,
+          "async_receive(provided_buffer_ring)"));
+
+    if (multishot)
+    {
+      io_uring_service_.start_multishot_op(impl.io_object_data_, p.p,
+          &op::discard_result, &ring, is_continuation);
+    }
+    else
+      start_op(impl, op_type, p.p, is_continuation, false);
+    p.v = p.p = 0;
+  }
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+
   // Wait until data can be received without blocking.
   template <typename Handler, typename IoExecutor>
   void async_receive(base_implementation_type& impl,
@@ -473,6 +526,80 @@ public:
     p.v = p.p = 0;
   }
 
+  // Start an asynchronous send followed by an asynchronous receive. Where
+  // possible the receive is linked to the send, so that both are submitted to
+  // the io_uring together. Otherwise, the receive is started once all of the
+  // data has been sent.
+  template <typename ConstBufferSequence, typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_send_then_receive(base_implementation_type& impl,
+      const ConstBufferSequence& send_buffers,
+      const MutableBufferSequence& receive_buffers,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    if ((flags & socket_base::message_out_of_band) != 0
+        || !io_uring_socket_send_op_base<ConstBufferSequence>::is_linkable(
+          impl.state_, flags)
+        || ((impl.state_ & socket_ops::stream_oriented)
+          && (buffer_sequence_adapter<boost::asio::const_buffer,
+              ConstBufferSequence>::all_empty(send_buffers)
+            || buffer_sequence_adapter<boost::asio::mutable_buffer,
+              MutableBufferSequence>::all_empty(receive_buffers))))
+    {
+      typedef socket_send_then_receive_op<io_uring_socket_service_base,
+          base_implementation_type, ConstBufferSequence,
+          MutableBufferSequence, Handler, IoExecutor> op;
+      op o(*this, impl, send_buffers, receive_buffers, flags, handler, io_ex);
+      async_send(impl, send_buffers, flags, o, io_ex);
+      return;
+    }
+
+    bool is_continuation =
+      boost_asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = boost::asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_send_recv_op<io_uring_socket_service_base,
+        base_implementation_type, ConstBufferSequence,
+        MutableBufferSequence, Handler, IoExecutor> op;
+    typename op::ptr p = { boost::asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, *this, impl,
+        send_buffers, receive_buffers, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      void* cancellation_key =
+        &slot.template emplace<io_uring_op_cancellation>(
+            &io_uring_service_, &impl.io_object_data_,
+            io_uring_service::write_op, io_uring_service::read_op);
+      p.p->send_op()->cancellation_key_ = cancellation_key;
+      p.p->receive_op()->cancellation_key_ = cancellation_key;
+    }
+
+    BOOST_ASIO_HANDLER_CREATION((io_uring_service_.context(),
+          *p.p->send_op(), "socket", &impl, impl.socket_,
+          "async_send_then_receive"));
+
+    io_uring_service_.start_linked_ops(impl.io_object_data_,
+        io_uring_service::write_op, p.p->send_op(),
+        io_uring_service::read_op, p.p->receive_op(), is_continuation);
+    p.v = p.p = 0;
+  }
+
+  // Cancel the receive operation that was started with the specified
+  // cancellation key.
+  void cancel_receive_by_key(base_implementation_type& impl,
+      void* cancellation_key)
+  {
+    io_uring_service_.cancel_ops_by_key(impl.io_object_data_,
+        io_uring_service::read_op, cancellation_key);
+  }
+
   // Receive some data with associated flags. Returns the number of bytes
   // received.
   template <typename MutableBufferSequence>
@@ -614,15 +741,27 @@ protected:
   BOOST_ASIO_DECL void start_accept_op(base_implementation_type& impl,
       io_uring_operation* op, bool is_continuation, bool peer_is_open);
 
+  // Get the I/O queue used for accept operations on the socket.
+  static int accept_op_type(const base_implementation_type& impl)
+  {
+    return (impl.state_ & socket_ops::multishot_accept)
+      ? io_uring_service::multishot_op : io_uring_service::read_op;
+  }
+
+  // Close an accepted socket that was not consumed by an accept operation.
+  BOOST_ASIO_DECL static void discard_accepted_socket(
+      void* context, int result, unsigned flags);
+
   // Helper class used to implement per-operation cancellation
   class io_uring_op_cancellation
   {
   public:
     io_uring_op_cancellation(io_uring_service* s,
-        io_uring_service::per_io_object_data* p, int o)
+        io_uring_service::per_io_object_data* p, int o, int linked_o = -1)
       : io_uring_service_(s),
         io_object_data_(p),
-        op_type_(o)
+        op_type_(o),
+        linked_op_type_(linked_o)
     {
     }
 
@@ -634,6 +773,11 @@ protected:
               | cancellation_type::total)))
       {
         io_uring_service_->cancel_ops_by_key(*io_object_data_, op_type_, this);
+        if (linked_op_type_ >= 0)
+        {
+          io_uring_service_->cancel_ops_by_key(
+              *io_object_data_, linked_op_type_, this);
+        }
       }
     }
 
@@ -641,6 +785,7 @@ protected:
     io_uring_service* io_uring_service_;
     io_uring_service::per_io_object_data* io_object_data_;
     int op_type_;
+    int linked_op_type_;
   };
 
   // The io_uring_service that performs event demultiplexing for the service.
@@ -648,6 +793,9 @@ protected:
 
   // Cached success value to avoid accessing category singleton.
   const boost::system::error_code success_ec_;
+
+  // The busy-poll time to be applied to newly opened sockets, in microseconds.
+  const int busy_poll_usec_;
 };
 
 } // namespace detail
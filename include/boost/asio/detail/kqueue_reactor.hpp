@@ -205,6 +205,26 @@ public:
       typename timer_queue<TimeTraits, Allocator>::per_timer_data& target,
       typename timer_queue<TimeTraits, Allocator>::per_timer_data& source);
 
+  // Change the expiry time of the timer operations associated with the given
+  // timer, without cancelling them.
+  template <typename TimeTraits, typename Allocator>
+  void reschedule_timer(timer_queue<TimeTraits, Allocator>& queue,
+      const typename TimeTraits::time_type& time,
+      typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer);
+
+  // Schedule a periodic operation associated with the given timer, cancelling
+  // any periodic operation that is already associated with the timer.
+  template <typename TimeTraits, typename Allocator>
+  void schedule_periodic_timer(timer_queue<TimeTraits, Allocator>& queue,
+      typename timer_queue<TimeTraits, Allocator>::per_timer_data& timer,
+      typename timer_queue<TimeTraits, Allocator>::periodic_op* op);
+
+  // Schedule a periodic operation that has completed to expire again. Returns
+  // false if the scheduler has been shut down.
+  template <typename TimeTraits, typename Allocator>
+  bool requeue_periodic_timer(timer_queue<TimeTraits, Allocator>& queue,
+      typename timer_queue<TimeTraits, Allocator>::periodic_op* op);
+
   // Run the kqueue loop.
   BOOST_ASIO_DECL void run(long usec, op_queue<operation>& ops);
 
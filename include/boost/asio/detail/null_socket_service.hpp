@@ -20,9 +20,11 @@
 #if defined(BOOST_ASIO_WINDOWS_RUNTIME)
 
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/datagram_slot.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/execution_context.hpp>
 #include <boost/asio/post.hpp>
+#include <boost/asio/provided_buffer_ring.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/asio/detail/bind_handler.hpp>
 
@@ -324,6 +326,17 @@ public:
           handler, ec, bytes_transferred));
   }
 
+  // Start an asynchronous receive into a buffer selected from a ring of
+  // provided buffers.
+  template <typename Handler, typename IoExecutor>
+  void async_receive(implementation_type&, provided_buffer_ring_base&,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, provided_buffer()));
+  }
+
   // Wait until data can be received without blocking.
   template <typename Handler, typename IoExecutor>
   void async_receive(implementation_type&, const null_buffers&,
@@ -335,6 +348,19 @@ public:
           handler, ec, bytes_transferred));
   }
 
+  // Start an asynchronous send followed by an asynchronous receive.
+  template <typename ConstBufferSequence, typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_send_then_receive(implementation_type&,
+      const ConstBufferSequence&, const MutableBufferSequence&,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    const std::size_t bytes_transferred = 0;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, bytes_transferred, bytes_transferred));
+  }
+
   // Receive some data with associated flags. Returns the number of bytes
   // received.
   template <typename MutableBufferSequence>
@@ -473,6 +499,56 @@ public:
           handler, ec, bytes_transferred));
   }
 
+  // Start an asynchronous send of a batch of datagrams.
+  template <typename Handler, typename IoExecutor>
+  void async_send_to_many(implementation_type&,
+      datagram_slot<const_buffer, endpoint_type>*, std::size_t,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    const std::size_t datagrams_transferred = 0;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, datagrams_transferred));
+  }
+
+  // Start an asynchronous receive of a batch of datagrams.
+  template <typename Handler, typename IoExecutor>
+  void async_receive_from_many(implementation_type&,
+      datagram_slot<mutable_buffer, endpoint_type>*, std::size_t,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    const std::size_t datagrams_transferred = 0;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, datagrams_transferred));
+  }
+
+  // Start an asynchronous send of data split into datagrams of the specified
+  // segment size.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_send_to_segmented(implementation_type&,
+      const ConstBufferSequence&, const endpoint_type&, std::size_t,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    const std::size_t bytes_transferred = 0;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, bytes_transferred));
+  }
+
+  // Start an asynchronous receive of data coalesced from several datagrams.
+  template <typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_receive_from_coalesced(implementation_type&,
+      const MutableBufferSequence&, endpoint_type&, std::size_t&,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    const std::size_t bytes_transferred = 0;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, bytes_transferred));
+  }
+
   // Accept a new connection.
   template <typename Socket>
   boost::system::error_code accept(implementation_type&,
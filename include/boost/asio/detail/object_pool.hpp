@@ -16,6 +16,7 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include <boost/asio/detail/config.hpp>
+#include <cstddef>
 #include <boost/asio/detail/memory.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
@@ -24,33 +25,53 @@ namespace boost {
 namespace asio {
 namespace detail {
 
+// A pool of objects linked through their next_ and prev_ members. Objects are
+// allocated individually, or, if a slab size greater than one is given, in
+// contiguous slabs so that objects allocated together are close in memory.
 template <typename Object, typename Allocator>
 class object_pool
 {
 public:
   // Constructor.
   template <typename... Args>
-  object_pool(const Allocator& allocator,
-      unsigned int preallocated, Args... args)
+  object_pool(const Allocator& allocator, unsigned int preallocated,
+      unsigned int slab_size, Args... args)
     : allocator_(allocator),
+      slab_size_(slab_size),
+      slabs_(0),
       live_list_(0),
       free_list_(0)
   {
-    while (preallocated > 0)
+    if (slab_size_ > 1)
     {
-      Object* o = allocate_object<Object>(allocator_, args...);
-      o->next_ = free_list_;
-      o->prev_ = 0;
-      free_list_ = o;
-      --preallocated;
+      if (preallocated > 0)
+        allocate_slab(preallocated, args...);
+    }
+    else
+    {
+      while (preallocated > 0)
+      {
+        Object* o = allocate_object<Object>(allocator_, args...);
+        o->next_ = free_list_;
+        o->prev_ = 0;
+        free_list_ = o;
+        --preallocated;
+      }
     }
   }
 
   // Destructor destroys all objects.
   ~object_pool()
   {
-    destroy_list(live_list_);
-    destroy_list(free_list_);
+    if (slab_size_ > 1)
+    {
+      destroy_slabs();
+    }
+    else
+    {
+      destroy_list(live_list_);
+      destroy_list(free_list_);
+    }
   }
 
   // Get the object at the start of the live list.
@@ -66,6 +87,12 @@ public:
     Object* o = free_list_;
     if (o)
       free_list_ = free_list_->next_;
+    else if (slab_size_ > 1)
+    {
+      allocate_slab(slab_size_, args...);
+      o = free_list_;
+      free_list_ = free_list_->next_;
+    }
     else
       o = allocate_object<Object>(allocator_, args...);
 
@@ -99,6 +126,91 @@ private:
   object_pool(const object_pool&) = delete;
   object_pool& operator=(const object_pool&) = delete;
 
+  // A contiguous block of objects.
+  struct slab
+  {
+    slab* next_;
+    Object* objects_;
+    std::size_t size_;
+  };
+
+  // Helper function to allocate a slab of objects and add them to the free
+  // list, such that they are subsequently allocated in address order.
+  template <typename... Args>
+  void allocate_slab(std::size_t size, Args... args)
+  {
+    typename std::allocator_traits<Allocator>::template
+      rebind_alloc<Object> alloc(allocator_);
+    slab* s = allocate_object<slab>(allocator_);
+    s->next_ = 0;
+    s->size_ = 0;
+#if !defined(BOOST_ASIO_NO_EXCEPTIONS)
+    try
+#endif // !defined(BOOST_ASIO_NO_EXCEPTIONS)
+    {
+      s->objects_ = std::allocator_traits<decltype(alloc)>::allocate(
+          alloc, size);
+    }
+#if !defined(BOOST_ASIO_NO_EXCEPTIONS)
+    catch (...)
+    {
+      deallocate_object(allocator_, s);
+      throw;
+    }
+#endif // !defined(BOOST_ASIO_NO_EXCEPTIONS)
+
+#if !defined(BOOST_ASIO_NO_EXCEPTIONS)
+    try
+#endif // !defined(BOOST_ASIO_NO_EXCEPTIONS)
+    {
+      for (; s->size_ < size; ++s->size_)
+        new (s->objects_ + s->size_) Object(args...);
+    }
+#if !defined(BOOST_ASIO_NO_EXCEPTIONS)
+    catch (...)
+    {
+      s->next_ = 0;
+      destroy_slab(s, size);
+      throw;
+    }
+#endif // !defined(BOOST_ASIO_NO_EXCEPTIONS)
+
+    for (std::size_t i = size; i > 0; --i)
+    {
+      Object* o = s->objects_ + (i - 1);
+      o->next_ = free_list_;
+      o->prev_ = 0;
+      free_list_ = o;
+    }
+
+    s->next_ = slabs_;
+    slabs_ = s;
+  }
+
+  // Helper function to destroy the constructed objects in a slab and free its
+  // memory, given the number of objects for which memory was allocated.
+  void destroy_slab(slab* s, std::size_t capacity)
+  {
+    typename std::allocator_traits<Allocator>::template
+      rebind_alloc<Object> alloc(allocator_);
+    for (std::size_t i = 0; i < s->size_; ++i)
+      std::allocator_traits<decltype(alloc)>::destroy(alloc, s->objects_ + i);
+    std::allocator_traits<decltype(alloc)>::deallocate(
+        alloc, s->objects_, capacity);
+    deallocate_object(allocator_, s);
+  }
+
+  // Helper function to destroy all slabs.
+  void destroy_slabs()
+  {
+    while (slabs_)
+    {
+      slab* s = slabs_;
+      slabs_ = s->next_;
+      destroy_slab(s, s->size_);
+    }
+  }
+
   // Helper function to destroy all elements in a list.
   void destroy_list(Object* list)
   {
@@ -113,6 +225,13 @@ private:
   // The execution_context allocator used to manage pooled object memory.
   Allocator allocator_;
 
+  // The number of objects to allocate at a time, or 1 if objects are allocated
+  // individually.
+  const unsigned int slab_size_;
+
+  // The slabs, when objects are allocated in slabs.
+  slab* slabs_;
+
   // The list of live objects.
   Object* live_list_;
 
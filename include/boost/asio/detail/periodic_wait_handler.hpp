@@ -0,0 +1,155 @@
+//
+// detail/periodic_wait_handler.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_PERIODIC_WAIT_HANDLER_HPP
+#define BOOST_ASIO_DETAIL_PERIODIC_WAIT_HANDLER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <boost/asio/detail/bind_handler.hpp>
+#include <boost/asio/detail/fenced_block.hpp>
+#include <boost/asio/detail/handler_alloc_helpers.hpp>
+#include <boost/asio/detail/handler_work.hpp>
+#include <boost/asio/detail/memory.hpp>
+#include <boost/asio/detail/operation.hpp>
+#include <boost/asio/error.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// A wait operation that completes each time its timer's period elapses. The
+// operation is reused for each expiry, and is freed only when the wait is
+// cancelled.
+template <typename Handler, typename IoExecutor, typename Service>
+class periodic_wait_handler : public Service::periodic_op
+{
+public:
+  BOOST_ASIO_DEFINE_HANDLER_PTR(periodic_wait_handler);
+
+  periodic_wait_handler(Handler& h, const IoExecutor& io_ex,
+      Service& service, const typename Service::time_type& expiry,
+      const typename Service::duration_type& interval)
+    : Service::periodic_op(&periodic_wait_handler::do_complete,
+        expiry, interval),
+      handler_(static_cast<Handler&&>(h)),
+      work_(handler_, io_ex),
+      service_(service)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const boost::system::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    periodic_wait_handler* h(static_cast<periodic_wait_handler*>(base));
+
+    if (owner && !h->ec_ && !h->aborted())
+    {
+      BOOST_ASIO_HANDLER_COMPLETION((*h));
+
+      // Make the upcall with a copy of the handler, keeping the operation and
+      // its outstanding work for the next expiry.
+      {
+        on_upcall_exit on_exit = { h };
+
+        Handler handler_copy(h->handler_);
+        detail::binder1<Handler, boost::system::error_code>
+          handler(handler_copy, h->ec_);
+        fenced_block b(fenced_block::half);
+        BOOST_ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_));
+        h->work_.complete(handler, handler.handler_);
+        BOOST_ASIO_HANDLER_INVOCATION_END;
+
+        on_exit.h_ = 0;
+      }
+
+      if (h->service_.requeue_periodic(h))
+        return;
+
+      // The scheduler was shut down while the handler was running.
+      h->abandon();
+      h->ec_ = boost::asio::error::operation_aborted;
+    }
+    else if (!owner)
+    {
+      // The operation is being destroyed, such as on shutdown.
+      h->abandon();
+    }
+    else if (h->aborted())
+    {
+      // The wait was cancelled while the handler was running.
+      h->ec_ = boost::asio::error::operation_aborted;
+    }
+
+    // Take ownership of the handler object.
+    ptr p = { boost::asio::detail::addressof(h->handler_), h, h };
+
+    BOOST_ASIO_HANDLER_COMPLETION((*h));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          h->work_));
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the final upcall is made.
+    detail::binder1<Handler, boost::system::error_code>
+      handler(h->handler_, h->ec_);
+    p.h = boost::asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      BOOST_ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_));
+      w.complete(handler, handler.handler_);
+      BOOST_ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  // Queues the operation again if the handler exits with an exception, so
+  // that the wait continues, or completes with operation_aborted if it was
+  // cancelled. The operation is destroyed if the scheduler has been shut
+  // down.
+  struct on_upcall_exit
+  {
+    ~on_upcall_exit()
+    {
+      if (h_ && !h_->service_.requeue_periodic(h_))
+      {
+        h_->abandon();
+        ptr p = { boost::asio::detail::addressof(h_->handler_), h_, h_ };
+        p.reset();
+      }
+    }
+
+    periodic_wait_handler* h_;
+  };
+
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+  Service& service_;
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_PERIODIC_WAIT_HANDLER_HPP
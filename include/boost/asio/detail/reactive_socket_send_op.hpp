@@ -37,14 +37,17 @@ class reactive_socket_send_op_base : public reactor_op
 public:
   reactive_socket_send_op_base(const boost::system::error_code& success_ec,
       socket_type socket, socket_ops::state_type state,
-      const ConstBufferSequence& buffers,
-      socket_base::message_flags flags, func_type complete_func)
+      const ConstBufferSequence& buffers, socket_base::message_flags flags,
+      unsigned int* zero_copy_sequence, func_type complete_func)
     : reactor_op(success_ec,
         &reactive_socket_send_op_base::do_perform, complete_func),
       socket_(socket),
       state_(state),
       buffers_(buffers),
-      flags_(flags)
+      flags_(flags),
+      zero_copy_sequence_(zero_copy_sequence),
+      zero_copy_id_(0),
+      zero_copy_pending_(false)
   {
   }
 
@@ -57,6 +60,12 @@ public:
     typedef buffer_sequence_adapter<boost::asio::const_buffer,
         ConstBufferSequence> bufs_type;
 
+#if defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+    if ((o->state_ & socket_ops::zero_copy_send) != 0
+        && o->zero_copy_sequence_ != 0)
+      return do_perform_zero_copy(o);
+#endif // defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+
     status result;
     if (bufs_type::is_single_buffer)
     {
@@ -90,10 +99,64 @@ public:
   }
 
 private:
+#if defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+  static status do_perform_zero_copy(reactive_socket_send_op_base* o)
+  {
+    typedef buffer_sequence_adapter<boost::asio::const_buffer,
+        ConstBufferSequence> bufs_type;
+
+    if (!o->zero_copy_pending_)
+    {
+      bool sent;
+      if (bufs_type::is_single_buffer)
+      {
+        sent = socket_ops::non_blocking_send1(o->socket_,
+            bufs_type::first(o->buffers_).data(),
+            bufs_type::first(o->buffers_).size(), o->flags_ | MSG_ZEROCOPY,
+            o->ec_, o->bytes_transferred_);
+      }
+      else
+      {
+        bufs_type bufs(o->buffers_);
+        sent = socket_ops::non_blocking_send(o->socket_,
+            bufs.buffers(), bufs.count(), o->flags_ | MSG_ZEROCOPY,
+            o->ec_, o->bytes_transferred_);
+      }
+
+      BOOST_ASIO_HANDLER_REACTOR_OPERATION((*o, "non_blocking_send",
+            o->ec_, o->bytes_transferred_));
+
+      if (!sent)
+        return not_done;
+      if (o->ec_ || o->bytes_transferred_ == 0)
+        return done;
+
+      // The kernel numbers each successful zero-copy send on the socket.
+      o->zero_copy_id_ = (*o->zero_copy_sequence_)++;
+      o->zero_copy_pending_ = true;
+    }
+
+    // The operation is complete only once the kernel has released the buffers.
+    boost::system::error_code ec;
+    if (!socket_ops::non_blocking_zero_copy_complete(
+          o->socket_, o->zero_copy_id_, ec))
+      return not_done;
+    if (ec)
+    {
+      o->ec_ = ec;
+      o->bytes_transferred_ = 0;
+    }
+    return done;
+  }
+#endif // defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+
   socket_type socket_;
   socket_ops::state_type state_;
   ConstBufferSequence buffers_;
   socket_base::message_flags flags_;
+  unsigned int* zero_copy_sequence_;
+  unsigned int zero_copy_id_;
+  bool zero_copy_pending_;
 };
 
 template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
@@ -109,9 +172,11 @@ public:
   reactive_socket_send_op(const boost::system::error_code& success_ec,
       socket_type socket, socket_ops::state_type state,
       const ConstBufferSequence& buffers, socket_base::message_flags flags,
-      Handler& handler, const IoExecutor& io_ex)
+      unsigned int* zero_copy_sequence, Handler& handler,
+      const IoExecutor& io_ex)
     : reactive_socket_send_op_base<ConstBufferSequence>(success_ec, socket,
-        state, buffers, flags, &reactive_socket_send_op::do_complete),
+        state, buffers, flags, zero_copy_sequence,
+        &reactive_socket_send_op::do_complete),
       handler_(static_cast<Handler&&>(handler)),
       work_(handler_, io_ex)
   {
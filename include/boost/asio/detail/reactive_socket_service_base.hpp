@@ -28,9 +28,11 @@
 #include <boost/asio/execution_context.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/asio/detail/buffer_sequence_adapter.hpp>
+#include <boost/asio/detail/call_stack.hpp>
 #include <boost/asio/detail/memory.hpp>
 #include <boost/asio/detail/reactive_null_buffers_op.hpp>
 #include <boost/asio/detail/reactive_socket_recv_op.hpp>
+#include <boost/asio/detail/reactive_socket_recv_provided_op.hpp>
 #include <boost/asio/detail/reactive_socket_recvmsg_op.hpp>
 #include <boost/asio/detail/reactive_socket_send_op.hpp>
 #include <boost/asio/detail/reactive_wait_op.hpp>
@@ -38,6 +40,7 @@
 #include <boost/asio/detail/reactor_op.hpp>
 #include <boost/asio/detail/socket_holder.hpp>
 #include <boost/asio/detail/socket_ops.hpp>
+#include <boost/asio/detail/socket_send_then_receive_op.hpp>
 #include <boost/asio/detail/socket_types.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
@@ -46,6 +49,8 @@ namespace boost {
 namespace asio {
 namespace detail {
 
+class scheduler;
+
 class reactive_socket_service_base
 {
 public:
@@ -129,6 +134,10 @@ public:
       int backlog, boost::system::error_code& ec)
   {
     socket_ops::listen(impl.socket_, backlog, ec);
+#if defined(BOOST_ASIO_HAS_EPOLL)
+    if (!ec)
+      reactor_.register_listening_descriptor(impl.socket_, impl.reactor_data_);
+#endif // defined(BOOST_ASIO_HAS_EPOLL)
     return ec;
   }
 
@@ -299,8 +308,8 @@ public:
         ConstBufferSequence, Handler, IoExecutor> op;
     typename op::ptr p = { boost::asio::detail::addressof(handler),
       op::ptr::allocate(handler), 0 };
-    p.p = new (p.v) op(success_ec_, impl.socket_,
-        impl.state_, buffers, flags, handler, io_ex);
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
+        buffers, flags, zero_copy_sequence(impl), handler, io_ex);
 
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
@@ -430,6 +439,47 @@ public:
     p.v = p.p = 0;
   }
 
+  // Start an asynchronous receive into a buffer selected from a ring of
+  // provided buffers. The ring must be valid for the lifetime of the
+  // asynchronous operation.
+  template <typename Handler, typename IoExecutor>
+  void async_receive(base_implementation_type& impl,
+      provided_buffer_ring_base& ring, socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      boost_asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = boost::asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_recv_provided_op<Handler, IoExecutor> op;
+    typename op::ptr p = { boost::asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        impl.state_, ring, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::read_op);
+    }
+
+    BOOST_ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_receive(provided_buffer_ring)"));
+
+    start_op(impl,
+        (flags & socket_base::message_out_of_band)
+          ? reactor::except_op : reactor::read_op,
+        p.p, is_continuation,
+        (flags & socket_base::message_out_of_band) == 0,
+        false, true, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+
   // Wait until data can be received without blocking.
   template <typename Handler, typename IoExecutor>
   void async_receive(base_implementation_type& impl,
@@ -466,6 +516,23 @@ public:
     p.v = p.p = 0;
   }
 
+  // Start an asynchronous send followed by an asynchronous receive. The
+  // receive is started once all of the data has been sent.
+  template <typename ConstBufferSequence, typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_send_then_receive(base_implementation_type& impl,
+      const ConstBufferSequence& send_buffers,
+      const MutableBufferSequence& receive_buffers,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    typedef socket_send_then_receive_op<reactive_socket_service_base,
+        base_implementation_type, ConstBufferSequence,
+        MutableBufferSequence, Handler, IoExecutor> op;
+    op o(*this, impl, send_buffers, receive_buffers, flags, handler, io_ex);
+    async_send(impl, send_buffers, flags, o, io_ex);
+  }
+
   // Receive some data with associated flags. Returns the number of bytes
   // received.
   template <typename MutableBufferSequence>
@@ -581,6 +648,19 @@ public:
   }
 
 protected:
+  // Get the sequence number of the next zero-copy send on the socket. This is
+  // held by the reactor, as it must not move with the implementation while a
+  // send is in progress. Returns null if zero-copy sends are not supported.
+  unsigned int* zero_copy_sequence(base_implementation_type& impl)
+  {
+#if defined(BOOST_ASIO_HAS_EPOLL)
+    return reactor_.zero_copy_sequence(impl.reactor_data_);
+#else // defined(BOOST_ASIO_HAS_EPOLL)
+    (void)impl;
+    return 0;
+#endif // defined(BOOST_ASIO_HAS_EPOLL)
+  }
+
   // Open a new socket implementation.
   BOOST_ASIO_DECL boost::system::error_code do_open(
       base_implementation_type& impl, int af,
@@ -625,11 +705,37 @@ protected:
         >::value
       >*)
   {
+    if (inline_completion_depth_ > 0
+        && (impl.state_ & socket_ops::inline_completion) != 0)
+    {
+      return do_start_op_with_inline_completion(impl, op_type, op,
+          is_continuation, allow_speculative, noop, needs_non_blocking);
+    }
+
     return do_start_op(impl, op_type, op, is_continuation,
         allow_speculative, noop, needs_non_blocking,
         &reactor::call_post_immediate_completion, &reactor_);
   }
 
+  // Start the asynchronous read or write operation, completing it inline if it
+  // finishes immediately and the inline completion depth has not been reached.
+  BOOST_ASIO_DECL void do_start_op_with_inline_completion(
+      base_implementation_type& impl, int op_type, reactor_op* op,
+      bool is_continuation, bool allow_speculative, bool noop,
+      bool needs_non_blocking);
+
+  // Records an operation that finished immediately, so that it may be
+  // completed once the reactor has released its locks.
+  struct deferred_immediate_completion
+  {
+    operation* op_;
+    bool is_continuation_;
+  };
+
+  // Helper function used to defer an immediate completion.
+  BOOST_ASIO_DECL static void call_defer_immediate_completion(
+      operation* op, bool is_continuation, const void* arg);
+
   // Start the asynchronous accept operation.
   BOOST_ASIO_DECL void do_start_accept_op(base_implementation_type& impl,
       reactor_op* op, bool is_continuation, bool peer_is_open,
@@ -736,11 +842,23 @@ protected:
   // The selector that performs event demultiplexing for the service.
   reactor& reactor_;
 
+  // The scheduler used to determine whether operations may complete inline.
+  scheduler& scheduler_;
+
   // Cached success value to avoid accessing category singleton.
   const boost::system::error_code success_ec_;
 
   // Extra state flags to be applied to newly opened sockets.
   socket_ops::state_type extra_state_;
+
+  // The busy-poll time to be applied to newly opened sockets, in microseconds.
+  const int busy_poll_usec_;
+
+  // The maximum number of nested inline completions on a thread.
+  const int inline_completion_depth_;
+
+  // Used to track the number of nested inline completions on a thread.
+  typedef call_stack<reactive_socket_service_base, int> inline_call_stack;
 };
 
 } // namespace detail
@@ -20,8 +20,10 @@
 #include <boost/system/error_code.hpp>
 #include <boost/asio/execution_context.hpp>
 #include <boost/asio/detail/atomic_count.hpp>
+#include <boost/asio/detail/atomic_op_queue.hpp>
 #include <boost/asio/detail/conditionally_enabled_event.hpp>
 #include <boost/asio/detail/conditionally_enabled_mutex.hpp>
+#include <boost/asio/detail/mutex.hpp>
 #include <boost/asio/detail/op_queue.hpp>
 #include <boost/asio/detail/scheduler_operation.hpp>
 #include <boost/asio/detail/scheduler_task.hpp>
@@ -155,6 +157,11 @@ private:
   BOOST_ASIO_DECL std::size_t do_run_one(mutex::scoped_lock& lock,
       thread_info& this_thread, const boost::system::error_code& ec);
 
+  // Run at most one operation, taking handlers from the per-thread queues
+  // before the shared queue. The lock is not held on entry. May block.
+  BOOST_ASIO_DECL std::size_t do_run_one_stealing(mutex::scoped_lock& lock,
+      thread_info& this_thread, const boost::system::error_code& ec);
+
   // Run at most one operation with a timeout. May block.
   BOOST_ASIO_DECL std::size_t do_wait_one(mutex::scoped_lock& lock,
       thread_info& this_thread, long usec, const boost::system::error_code& ec);
@@ -163,6 +170,60 @@ private:
   BOOST_ASIO_DECL std::size_t do_poll_one(mutex::scoped_lock& lock,
       thread_info& this_thread, const boost::system::error_code& ec);
 
+  // Repeatedly poll the task without blocking, until handlers are ready to run
+  // or the busy-poll budget is exhausted. The lock is not held on entry or on
+  // exit. Returns false if the task must now be run with a blocking wait, in
+  // which case the task has been marked as interruptible.
+  BOOST_ASIO_DECL bool busy_poll_task(mutex::scoped_lock& lock,
+      thread_info& this_thread);
+
+  // Initialise the thread-specific data for a thread entering the scheduler.
+  BOOST_ASIO_DECL void init_thread_info(thread_info& this_thread);
+
+  // Notify that some work has finished.
+  void work_finished(long n)
+  {
+    if ((outstanding_work_ -= n) == 0)
+      stop();
+  }
+
+  // Notify that some work has started, offsetting it against any work that
+  // the calling thread has finished but not yet counted.
+  BOOST_ASIO_DECL void work_started(thread_info_base* this_thread, long n);
+
+  // Count the work that the calling thread has finished. The lock must be
+  // held. Returns false, after stopping all threads, if there is no more
+  // unfinished work.
+  BOOST_ASIO_DECL bool flush_finished_work(mutex::scoped_lock& lock,
+      thread_info& this_thread);
+
+  // Add operations to the per-thread queue of the calling thread, and wake an
+  // idle thread to take them if there is one.
+  BOOST_ASIO_DECL void push_work_queue(
+      thread_info& this_thread, op_queue<operation>& ops);
+
+  // Take an operation from the per-thread queue of the calling thread, or
+  // steal one from the queue of another thread. Sets stopped if the scheduler
+  // has been stopped.
+  BOOST_ASIO_DECL operation* pop_work_queue(
+      thread_info& this_thread, bool& stopped);
+
+  // Determine whether any per-thread queue has operations. The lock must be
+  // held.
+  BOOST_ASIO_DECL bool work_queues_have_operations();
+
+  // Move the operations from all per-thread queues to the shared queue. The
+  // lock must be held.
+  BOOST_ASIO_DECL void flush_work_queues();
+
+  // The number of consecutive handlers a thread may take from the per-thread
+  // queues before it checks the shared queue.
+  enum { max_work_queue_handlers = 64 };
+
+  // Move the operations posted from outside the scheduler to the shared queue,
+  // unless other handlers are already waiting to run. The lock must be held.
+  BOOST_ASIO_DECL void flush_injection_queue();
+
   // Stop the task and all idle threads.
   BOOST_ASIO_DECL void stop_all_threads(mutex::scoped_lock& lock);
 
@@ -186,9 +247,64 @@ private:
   struct work_cleanup;
   friend struct work_cleanup;
 
+  // Helper class to count a thread's finished work on exit from run().
+  struct finished_work_cleanup;
+  friend struct finished_work_cleanup;
+
+  // A queue of ready handlers belonging to the threads running the scheduler,
+  // used when work stealing is enabled. Handlers posted by a scheduler thread
+  // are added to its own queue, and threads that have run out of handlers
+  // take them from the queues of other threads. Each queue is padded so that
+  // the queues of neighbouring threads do not share a cache line.
+  struct work_queue
+  {
+    work_queue() : stopped_(false) {}
+    boost::asio::detail::mutex mutex_;
+    op_queue<operation> op_queue_;
+    bool stopped_;
+    char padding_[BOOST_ASIO_CACHE_LINE_SIZE];
+  };
+
+  // The data members are grouped so that data written by every thread, such as
+  // the mutex and the count of unfinished work, does not share a cache line
+  // with data that is only read once the scheduler has been constructed.
+  enum { cache_line_size = BOOST_ASIO_CACHE_LINE_SIZE };
+
   // Whether to optimise for single-threaded use cases.
   const bool one_thread_;
 
+  // The function used to get the task.
+  get_task_func_type get_task_;
+
+  // The time limit on running the scheduler task, in microseconds.
+  const long task_usec_;
+
+  // The time limit on waiting when the queue is empty, in microseconds.
+  const long wait_usec_;
+
+  // The maximum time to spend polling the task without blocking, before the
+  // task is run with a blocking wait, in microseconds.
+  const long busy_poll_usec_;
+
+  // The number of per-thread queues, or 0 if work stealing is disabled.
+  const std::size_t num_work_queues_;
+
+  // The per-thread queues.
+  work_queue* work_queues_;
+
+  // Whether operations posted from outside the scheduler are added to the
+  // injection queue rather than to the shared queue.
+  const bool use_injection_queue_;
+
+  // Whether threads that call run() allocate handlers from per-thread arenas.
+  const bool use_handler_arena_;
+
+  // The number of finished handlers that a thread calling run() may count
+  // privately before updating the count of unfinished work.
+  const long work_count_batch_;
+
+  char padding1_[cache_line_size];
+
   // Mutex to protect access to internal data.
   mutable mutex mutex_;
 
@@ -198,9 +314,6 @@ private:
   // The task to be run by this service.
   scheduler_task* task_;
 
-  // The function used to get the task.
-  get_task_func_type get_task_;
-
   // Operation object to represent the position of the task in the queue.
   struct task_operation : operation
   {
@@ -216,17 +329,39 @@ private:
   // Flag to indicate that the dispatcher has been shut down.
   bool shutdown_;
 
+  // The queue of handlers that are ready to be delivered.
+  op_queue<operation> op_queue_;
+
+  // The current busy-poll budget, in microseconds. The budget shrinks while
+  // polling finds no work, and is restored when polling finds work. Only
+  // accessed by the thread that is running the task.
+  long busy_poll_budget_usec_;
+
+  char padding2_[cache_line_size];
+
   // The count of unfinished work.
   atomic_count outstanding_work_;
 
-  // The queue of handlers that are ready to be delivered.
-  op_queue<operation> op_queue_;
+  char padding3_[cache_line_size];
 
-  // The time limit on running the scheduler task, in microseconds.
-  const long task_usec_;
+  // Used to assign per-thread queues to threads in turn.
+  atomic_count next_work_queue_;
 
-  // The time limit on waiting when the queue is empty, in microseconds.
-  const long wait_usec_;
+  // The number of threads waiting for handlers when work stealing is enabled.
+  atomic_count idle_threads_;
+
+  // Non-zero while the task may block without being interrupted, when work
+  // stealing is enabled. Set before the per-thread queues are checked, so
+  // that threads adding handlers to the queues only need to acquire the lock
+  // to interrupt the task if it is non-zero.
+  atomic_count task_blocked_;
+
+  char padding4_[cache_line_size];
+
+  // Operations posted from outside the scheduler, which are moved to the shared
+  // queue by the threads running the scheduler. Only a post that finds the
+  // queue empty needs to acquire the lock and wake a thread.
+  atomic_op_queue<operation> injection_queue_;
 
   // The thread that is running the scheduler.
   boost::asio::detail::thread thread_;
@@ -31,6 +31,10 @@ struct scheduler_thread_info : public thread_info_base
 {
   op_queue<scheduler_operation> private_op_queue;
   long private_outstanding_work;
+  long private_finished_work;
+  long work_count_batch;
+  std::size_t work_queue_index;
+  std::size_t work_queue_handlers;
 };
 
 } // namespace detail
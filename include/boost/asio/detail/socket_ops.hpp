@@ -57,10 +57,49 @@ enum
 
   // When using an edge-triggered reactor (epoll) the user wants the edge to be
   // reset following a partial read on a stream-oriented socket.
-  reset_edge_on_partial_read = 128
+  reset_edge_on_partial_read = 128,
+
+  // When using io_uring, the user wants accept operations to be satisfied from
+  // a single persistent multishot accept.
+  multishot_accept = 256,
+
+  // When using io_uring, the user wants receive operations that select a
+  // provided buffer to be satisfied from a single persistent multishot receive.
+  multishot_receive = 512,
+
+  // The user wants send operations on a stream-oriented socket to avoid
+  // copying the data, completing only once the kernel has released it.
+  zero_copy_send = 1024,
+
+  // The user allows operations that finish immediately to be completed before
+  // the initiating function returns.
+  inline_completion = 2048
 };
 
-typedef unsigned char state_type;
+typedef unsigned short state_type;
+
+// The maximum number of datagrams transferred by a single batched operation.
+enum { max_batched_datagrams = 64 };
+
+// A datagram transferred as part of a batched send or receive operation.
+struct batched_datagram
+{
+  void* data;
+  std::size_t size;
+  void* addr;
+  std::size_t addrlen;
+  std::size_t bytes_transferred;
+};
+
+#if defined(BOOST_ASIO_HAS_UDP_GSO)
+// Storage for the ancillary data that carries a UDP segment size. The size_t
+// member gives the storage the alignment required for a cmsghdr.
+union segment_size_control
+{
+  std::size_t align;
+  char data[CMSG_SPACE(sizeof(int))];
+};
+#endif // defined(BOOST_ASIO_HAS_UDP_GSO)
 
 struct noop_deleter { void operator()(void*) {} };
 typedef shared_ptr<void> shared_cancel_token_type;
@@ -254,6 +293,16 @@ BOOST_ASIO_DECL bool non_blocking_send1(socket_type s,
     const void* data, size_t size, int flags,
     boost::system::error_code& ec, size_t& bytes_transferred);
 
+#if defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+
+// Drain the socket's error queue of zero-copy send notifications. Returns true
+// once the send with the specified sequence number has been released by the
+// kernel, or if an error occurred.
+BOOST_ASIO_DECL bool non_blocking_zero_copy_complete(socket_type s,
+    unsigned int sequence, boost::system::error_code& ec);
+
+#endif // defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+
 #endif // defined(BOOST_ASIO_HAS_IOCP)
 
 BOOST_ASIO_DECL signed_size_type sendto(socket_type s,
@@ -282,6 +331,70 @@ BOOST_ASIO_DECL bool non_blocking_sendto1(socket_type s, const void* data,
     size_t size, int flags, const void* addr, std::size_t addrlen,
     boost::system::error_code& ec, size_t& bytes_transferred);
 
+// Send a batch of datagrams, each to its own destination. Returns the number
+// of datagrams sent, which may be fewer than requested.
+BOOST_ASIO_DECL signed_size_type sendmmsg(socket_type s,
+    batched_datagram* msgs, size_t count, int flags,
+    boost::system::error_code& ec);
+
+BOOST_ASIO_DECL bool non_blocking_sendmmsg(socket_type s,
+    batched_datagram* msgs, size_t count, int flags,
+    boost::system::error_code& ec, size_t& datagrams_transferred);
+
+// Receive a batch of datagrams, recording the sender of each. Returns the
+// number of datagrams received, which may be fewer than requested.
+BOOST_ASIO_DECL signed_size_type recvmmsg(socket_type s,
+    batched_datagram* msgs, size_t count, int flags,
+    boost::system::error_code& ec);
+
+BOOST_ASIO_DECL bool non_blocking_recvmmsg(socket_type s,
+    batched_datagram* msgs, size_t count, int flags,
+    boost::system::error_code& ec, size_t& datagrams_transferred);
+
+// Check whether data can be sent with the specified segment size.
+BOOST_ASIO_DECL bool check_segment_size(std::size_t segment_size,
+    boost::system::error_code& ec);
+
+// Send data that the kernel splits into datagrams of the specified segment
+// size. A segment size of zero sends the data as a single datagram.
+BOOST_ASIO_DECL signed_size_type sendto_segmented(socket_type s,
+    const buf* bufs, size_t count, int flags, const void* addr,
+    std::size_t addrlen, std::size_t segment_size,
+    boost::system::error_code& ec);
+
+BOOST_ASIO_DECL bool non_blocking_sendto_segmented(socket_type s,
+    const buf* bufs, size_t count, int flags, const void* addr,
+    std::size_t addrlen, std::size_t segment_size,
+    boost::system::error_code& ec, size_t& bytes_transferred);
+
+// Receive data that the kernel may have coalesced from several datagrams,
+// obtaining the size of each datagram. When no coalescing took place, the
+// segment size is the number of bytes received.
+BOOST_ASIO_DECL signed_size_type recvfrom_coalesced(socket_type s,
+    buf* bufs, size_t count, int flags, void* addr, std::size_t* addrlen,
+    std::size_t* segment_size, boost::system::error_code& ec);
+
+BOOST_ASIO_DECL bool non_blocking_recvfrom_coalesced(socket_type s,
+    buf* bufs, size_t count, int flags, void* addr, std::size_t* addrlen,
+    std::size_t* segment_size, boost::system::error_code& ec,
+    size_t& bytes_transferred);
+
+#if defined(BOOST_ASIO_HAS_UDP_GSO)
+
+// Attach a segment size to an outgoing message.
+BOOST_ASIO_DECL void init_segment_size_control(msghdr& msg,
+    segment_size_control& control, std::size_t segment_size);
+
+// Prepare a message to receive the segment size of coalesced data.
+BOOST_ASIO_DECL void init_coalesced_control(msghdr& msg,
+    segment_size_control& control);
+
+// Extract the segment size from a received message.
+BOOST_ASIO_DECL std::size_t get_coalesced_segment_size(
+    msghdr& msg, std::size_t bytes_transferred);
+
+#endif // defined(BOOST_ASIO_HAS_UDP_GSO)
+
 #endif // !defined(BOOST_ASIO_HAS_IOCP)
 
 BOOST_ASIO_DECL socket_type socket(int af, int type, int protocol,
@@ -291,6 +404,16 @@ BOOST_ASIO_DECL int setsockopt(socket_type s, state_type& state,
     int level, int optname, const void* optval,
     std::size_t optlen, boost::system::error_code& ec);
 
+// Enable busy polling of the device queue when receiving on the socket, for
+// up to the specified number of microseconds.
+BOOST_ASIO_DECL int set_busy_poll(socket_type s, state_type& state,
+    int usec, boost::system::error_code& ec);
+
+// Enable busy polling on the socket if the specified number of microseconds is
+// positive. Busy polling is only an optimisation, so failure is ignored.
+BOOST_ASIO_DECL void maybe_set_busy_poll(
+    socket_type s, state_type& state, int usec);
+
 BOOST_ASIO_DECL int getsockopt(socket_type s, state_type state,
     int level, int optname, void* optval,
     size_t* optlen, boost::system::error_code& ec);
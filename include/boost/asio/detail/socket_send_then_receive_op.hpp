@@ -0,0 +1,158 @@
+//
+// detail/socket_send_then_receive_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_SOCKET_SEND_THEN_RECEIVE_OP_HPP
+#define BOOST_ASIO_DETAIL_SOCKET_SEND_THEN_RECEIVE_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+#include <boost/asio/associator.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/completion_condition.hpp>
+#include <boost/asio/socket_base.hpp>
+#include <boost/asio/detail/consuming_buffers.hpp>
+#include <boost/asio/detail/handler_cont_helpers.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// Composed operation used by socket services that implement a send followed
+// by a receive as consecutive asynchronous operations. The send is repeated
+// until all of the data has been sent, and the receive is started only if the
+// send succeeds.
+template <typename Service, typename Implementation,
+    typename ConstBufferSequence, typename MutableBufferSequence,
+    typename Handler, typename IoExecutor>
+class socket_send_then_receive_op
+{
+public:
+  socket_send_then_receive_op(Service& service, Implementation& impl,
+      const ConstBufferSequence& send_buffers,
+      const MutableBufferSequence& receive_buffers,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+    : service_(service),
+      impl_(impl),
+      send_buffers_(send_buffers),
+      receive_buffers_(receive_buffers),
+      flags_(flags),
+      receiving_(false),
+      handler_(static_cast<Handler&&>(handler)),
+      io_ex_(io_ex)
+  {
+  }
+
+  void operator()(const boost::system::error_code& ec,
+      std::size_t bytes_transferred)
+  {
+    if (!receiving_)
+    {
+      send_buffers_.consume(bytes_transferred);
+
+      // The I/O executor is copied as this object is moved into the next
+      // operation.
+      IoExecutor io_ex(io_ex_);
+      if (!ec && bytes_transferred > 0 && !send_buffers_.empty())
+      {
+        service_.async_send(impl_,
+            send_buffers_.prepare(default_max_transfer_size),
+            flags_, *this, io_ex);
+        return;
+      }
+      if (!ec)
+      {
+        receiving_ = true;
+        service_.async_receive(impl_, receive_buffers_, flags_, *this, io_ex);
+        return;
+      }
+      bytes_transferred = 0;
+    }
+
+    static_cast<Handler&&>(handler_)(ec,
+        static_cast<const std::size_t&>(send_buffers_.total_consumed()),
+        static_cast<const std::size_t&>(bytes_transferred));
+  }
+
+//private:
+  typedef consuming_buffers<const_buffer, ConstBufferSequence,
+      decltype(boost::asio::buffer_sequence_begin(
+          declval<const ConstBufferSequence&>()))> send_buffers_type;
+
+  Service& service_;
+  Implementation& impl_;
+  send_buffers_type send_buffers_;
+  MutableBufferSequence receive_buffers_;
+  socket_base::message_flags flags_;
+  bool receiving_;
+  Handler handler_;
+  IoExecutor io_ex_;
+};
+
+template <typename Service, typename Implementation,
+    typename ConstBufferSequence, typename MutableBufferSequence,
+    typename Handler, typename IoExecutor>
+inline bool asio_handler_is_continuation(
+    socket_send_then_receive_op<Service, Implementation, ConstBufferSequence,
+      MutableBufferSequence, Handler, IoExecutor>* this_handler)
+{
+  return (this_handler->receiving_
+      || this_handler->send_buffers_.total_consumed() > 0) ? true
+    : boost_asio_handler_cont_helpers::is_continuation(
+        this_handler->handler_);
+}
+
+} // namespace detail
+
+#if !defined(GENERATING_DOCUMENTATION)
+
+template <template <typename, typename> class Associator,
+    typename Service, typename Implementation,
+    typename ConstBufferSequence, typename MutableBufferSequence,
+    typename Handler, typename IoExecutor, typename DefaultCandidate>
+struct associator<Associator,
+    detail::socket_send_then_receive_op<Service, Implementation,
+      ConstBufferSequence, MutableBufferSequence, Handler, IoExecutor>,
+    DefaultCandidate>
+  : Associator<Handler, DefaultCandidate>
+{
+  static typename Associator<Handler, DefaultCandidate>::type get(
+      const detail::socket_send_then_receive_op<Service, Implementation,
+        ConstBufferSequence, MutableBufferSequence,
+        Handler, IoExecutor>& h) noexcept
+  {
+    return Associator<Handler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static auto get(
+      const detail::socket_send_then_receive_op<Service, Implementation,
+        ConstBufferSequence, MutableBufferSequence,
+        Handler, IoExecutor>& h,
+      const DefaultCandidate& c) noexcept
+    -> decltype(Associator<Handler, DefaultCandidate>::get(h.handler_, c))
+  {
+    return Associator<Handler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+#endif // !defined(GENERATING_DOCUMENTATION)
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_SOCKET_SEND_THEN_RECEIVE_OP_HPP
@@ -90,6 +90,12 @@
 #  include <sys/sockio.h>
 # endif
 # include <signal.h>
+# if defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
+#  include <linux/errqueue.h>
+#  if !defined(MSG_ZEROCOPY)
+#   define MSG_ZEROCOPY 0x4000000
+#  endif // !defined(MSG_ZEROCOPY)
+# endif // defined(BOOST_ASIO_HAS_MSG_ZEROCOPY)
 #endif
 
 #include <boost/asio/detail/push_options.hpp>
@@ -369,6 +375,11 @@ typedef int signed_size_type;
 # define BOOST_ASIO_OS_DEF_SO_RCVLOWAT SO_RCVLOWAT
 # define BOOST_ASIO_OS_DEF_SO_REUSEADDR SO_REUSEADDR
 # define BOOST_ASIO_OS_DEF_TCP_NODELAY TCP_NODELAY
+# if defined(BOOST_ASIO_HAS_UDP_GSO)
+// Values from <linux/udp.h>, which older C libraries do not expose.
+#  define BOOST_ASIO_OS_DEF_UDP_SEGMENT 103
+#  define BOOST_ASIO_OS_DEF_UDP_GRO 104
+# endif // defined(BOOST_ASIO_HAS_UDP_GSO)
 # define BOOST_ASIO_OS_DEF_IP_MULTICAST_IF IP_MULTICAST_IF
 # define BOOST_ASIO_OS_DEF_IP_MULTICAST_TTL IP_MULTICAST_TTL
 # define BOOST_ASIO_OS_DEF_IP_MULTICAST_LOOP IP_MULTICAST_LOOP
@@ -423,6 +434,10 @@ const int max_iov_len = 16;
 const int custom_socket_option_level = 0xA5100000;
 const int enable_connection_aborted_option = 1;
 const int always_fail_option = 2;
+const int multishot_accept_option = 3;
+const int multishot_receive_option = 4;
+const int zero_copy_send_option = 5;
+const int inline_completion_option = 6;
 
 } // namespace detail
 } // namespace asio
@@ -22,9 +22,17 @@
 #include <boost/asio/detail/mutex.hpp>
 #include <boost/asio/detail/op_queue.hpp>
 #include <boost/asio/detail/scheduler_operation.hpp>
+#include <boost/asio/detail/strand_state.hpp>
 #include <boost/asio/detail/type_traits.hpp>
 #include <boost/asio/execution.hpp>
 #include <boost/asio/execution_context.hpp>
+#include <boost/asio/strand_statistics.hpp>
+
+#if !defined(BOOST_ASIO_HAS_THREADS)
+// Nothing to include.
+#else // !defined(BOOST_ASIO_HAS_THREADS)
+# include <atomic>
+#endif // !defined(BOOST_ASIO_HAS_THREADS)
 
 #include <boost/asio/detail/push_options.hpp>
 
@@ -46,28 +54,37 @@ public:
   private:
     friend class strand_executor_service;
 
-    // Mutex to protect access to internal data.
-    mutex* mutex_;
-
-    // Indicates whether the strand is currently "locked" by a handler. This
-    // means that there is a handler upcall in progress, or that the strand
-    // itself has been scheduled in order to invoke some pending handlers.
-    bool locked_;
-
-    // Indicates that the strand has been shut down and will accept no further
-    // handlers.
-    bool shutdown_;
-
-    // The handlers that are waiting on the strand but should not be run until
-    // after the next time the strand is scheduled. This queue must only be
-    // modified while the mutex is locked.
-    op_queue<scheduler_operation> waiting_queue_;
+    // Indicates whether the strand is currently "locked" by a handler, and
+    // holds the handlers that are waiting on the strand but should not be run
+    // until after the next time the strand is scheduled. The strand is locked
+    // when there is a handler upcall in progress, or the strand itself has
+    // been scheduled in order to invoke some pending handlers.
+    strand_state<scheduler_operation> state_;
 
     // The handlers that are ready to be run. Logically speaking, these are the
     // handlers that hold the strand's lock. The ready queue is only modified
-    // from within the strand and so may be accessed without locking the mutex.
+    // from within the strand and so may be accessed without synchronisation.
     op_queue<scheduler_operation> ready_queue_;
 
+    // The number of handlers in the ready queue.
+    std::size_t ready_count_;
+
+    // A statistics counter, which may be read by any thread.
+#if !defined(BOOST_ASIO_HAS_THREADS)
+    typedef std::size_t statistics_counter;
+#else // !defined(BOOST_ASIO_HAS_THREADS)
+    typedef std::atomic<std::size_t> statistics_counter;
+#endif // !defined(BOOST_ASIO_HAS_THREADS)
+
+    // Statistics about the handlers run by the strand. Like the ready queue,
+    // these are only modified from within the strand, and so need not be
+    // updated atomically.
+    statistics_counter turns_;
+    statistics_counter handlers_;
+    statistics_counter max_handlers_per_turn_;
+    statistics_counter max_queue_depth_;
+    statistics_counter yields_;
+
     // Pointers to adjacent handle implementations in linked list.
     strand_impl* next_;
     strand_impl* prev_;
@@ -122,6 +139,10 @@ public:
   BOOST_ASIO_DECL static bool running_in_this_thread(
       const implementation_type& impl);
 
+  // Obtain statistics about the handlers run by the strand.
+  BOOST_ASIO_DECL static strand_statistics statistics(
+      const implementation_type& impl);
+
 private:
   friend class strand_impl;
   template <typename F, typename Allocator> class allocator_binder;
@@ -138,23 +159,43 @@ private:
   // Invokes all ready-to-run handlers.
   BOOST_ASIO_DECL static void run_ready_handlers(implementation_type& impl);
 
+  // Reads a statistics counter.
+  static std::size_t load_statistic(
+      const strand_impl::statistics_counter& counter)
+  {
+#if !defined(BOOST_ASIO_HAS_THREADS)
+    return counter;
+#else // !defined(BOOST_ASIO_HAS_THREADS)
+    return counter.load(std::memory_order_relaxed);
+#endif // !defined(BOOST_ASIO_HAS_THREADS)
+  }
+
+  // Sets a statistics counter. Called only from within the strand.
+  static void store_statistic(
+      strand_impl::statistics_counter& counter, std::size_t value)
+  {
+#if !defined(BOOST_ASIO_HAS_THREADS)
+    counter = value;
+#else // !defined(BOOST_ASIO_HAS_THREADS)
+    counter.store(value, std::memory_order_relaxed);
+#endif // !defined(BOOST_ASIO_HAS_THREADS)
+  }
+
   // Helper function to request invocation of the given function.
   template <typename Executor, typename Function, typename Allocator>
   static void do_execute(const implementation_type& impl, Executor& ex,
       Function&& function, const Allocator& a);
 
-  // Mutex to protect access to the service-wide state.
-  mutex mutex_;
+  // The maximum number of handlers to run each time the strand is scheduled,
+  // or 0 for no limit.
+  std::size_t handler_budget_;
 
-  // Number of mutexes shared between all strand objects.
-  enum { num_mutexes = 193 };
+  // The maximum time, in microseconds, for which to run handlers each time the
+  // strand is scheduled, or 0 for no limit.
+  long time_slice_usec_;
 
-  // Pool of mutexes.
-  shared_ptr<mutex> mutexes_[num_mutexes];
-
-  // Extra value used when hashing to prevent recycled memory locations from
-  // getting the same mutex.
-  std::size_t salt_;
+  // Mutex to protect access to the service-wide state.
+  mutex mutex_;
 
   // The head of a linked list of all implementations.
   strand_impl* impl_list_;
@@ -20,6 +20,7 @@
 #include <boost/asio/detail/mutex.hpp>
 #include <boost/asio/detail/op_queue.hpp>
 #include <boost/asio/detail/operation.hpp>
+#include <boost/asio/detail/strand_state.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
 
@@ -53,22 +54,16 @@ public:
     friend struct on_do_complete_exit;
     friend struct on_dispatch_exit;
 
-    // Mutex to protect access to internal data.
-    boost::asio::detail::mutex mutex_;
-
-    // Indicates whether the strand is currently "locked" by a handler. This
-    // means that there is a handler upcall in progress, or that the strand
-    // itself has been scheduled in order to invoke some pending handlers.
-    bool locked_;
-
-    // The handlers that are waiting on the strand but should not be run until
-    // after the next time the strand is scheduled. This queue must only be
-    // modified while the mutex is locked.
-    op_queue<operation> waiting_queue_;
+    // Indicates whether the strand is currently "locked" by a handler, and
+    // holds the handlers that are waiting on the strand but should not be run
+    // until after the next time the strand is scheduled. The strand is locked
+    // when there is a handler upcall in progress, or the strand itself has
+    // been scheduled in order to invoke some pending handlers.
+    strand_state<operation> state_;
 
     // The handlers that are ready to be run. Logically speaking, these are the
     // handlers that hold the strand's lock. The ready queue is only modified
-    // from within the strand and so may be accessed without locking the mutex.
+    // from within the strand and so may be accessed without synchronisation.
     op_queue<operation> ready_queue_;
   };
 
@@ -0,0 +1,239 @@
+//
+// detail/strand_state.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_STRAND_STATE_HPP
+#define BOOST_ASIO_DETAIL_STRAND_STATE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+#include <boost/asio/detail/atomic_op_queue.hpp>
+#include <boost/asio/detail/noncopyable.hpp>
+#include <boost/asio/detail/op_queue.hpp>
+
+#if !defined(BOOST_ASIO_HAS_THREADS)
+// Nothing to include.
+#else // !defined(BOOST_ASIO_HAS_THREADS)
+# include <atomic>
+#endif // !defined(BOOST_ASIO_HAS_THREADS)
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// The lock of a strand, together with the handlers waiting for the lock. The
+// state is a single word holding a pointer to the most recently added waiting
+// handler, a bit indicating whether the strand is locked, and a bit indicating
+// whether the strand has been shut down. Handlers may be added by any number
+// of threads concurrently without blocking. Only the holder of the lock may
+// remove them.
+template <typename Operation>
+class strand_state
+  : private noncopyable
+{
+public:
+  // The result of adding a handler to the strand.
+  enum enqueue_result
+  {
+    // The strand was not locked. The caller now holds the lock, and the
+    // handler was not added.
+    acquired,
+
+    // The handler was added to the waiting handlers.
+    waiting,
+
+    // The strand has been shut down. The handler was not added.
+    rejected
+  };
+
+  // Constructor.
+  strand_state()
+    : state_(0)
+  {
+  }
+
+  // Destructor destroys all waiting handlers.
+  ~strand_state()
+  {
+    op_queue<Operation> ops;
+    atomic_op_queue<Operation>::push_reversed(
+        to_operation(load(state_) & ~flags_mask), ops);
+  }
+
+  // Try to acquire the lock. Succeeds only if the strand is not locked, and so
+  // has no waiting handlers.
+  bool try_lock()
+  {
+#if defined(BOOST_ASIO_HAS_THREADS)
+    std::size_t state = 0;
+    return state_.compare_exchange_strong(state, locked_flag,
+        std::memory_order_acquire, std::memory_order_relaxed);
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    if (state_ != 0)
+      return false;
+    state_ = locked_flag;
+    return true;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+  }
+
+  // Add a handler to the strand, unless the lock can be acquired instead.
+  enqueue_result enqueue(Operation* op)
+  {
+    static_assert(alignof(Operation) > flags_mask,
+        "operations must be aligned to leave room for the flags");
+
+#if defined(BOOST_ASIO_HAS_THREADS)
+    std::size_t state = state_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      if ((state & shutdown_flag) != 0)
+        return rejected;
+
+      if (state == 0)
+      {
+        if (state_.compare_exchange_weak(state, locked_flag,
+              std::memory_order_acquire, std::memory_order_relaxed))
+          return acquired;
+      }
+      else
+      {
+        op_queue_access::next(op, to_operation(state & ~flags_mask));
+        if (state_.compare_exchange_weak(state,
+              reinterpret_cast<std::size_t>(op) | (state & flags_mask),
+              std::memory_order_release, std::memory_order_relaxed))
+          return waiting;
+      }
+    }
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    if ((state_ & shutdown_flag) != 0)
+      return rejected;
+
+    if (state_ == 0)
+    {
+      state_ = locked_flag;
+      return acquired;
+    }
+
+    op_queue_access::next(op, to_operation(state_ & ~flags_mask));
+    state_ = reinterpret_cast<std::size_t>(op) | (state_ & flags_mask);
+    return waiting;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+  }
+
+  // Transfer the waiting handlers to the ready queue. Must be called only by
+  // the holder of the lock, which is released if there are no handlers to be
+  // run. Returns true if the lock is still held.
+  bool push_waiting_to_ready(op_queue<Operation>& ready_queue)
+  {
+    std::size_t count = 0;
+    return push_waiting_to_ready(ready_queue, count);
+  }
+
+  // Transfer the waiting handlers to the ready queue, adding the number of
+  // handlers transferred to the given count.
+  bool push_waiting_to_ready(op_queue<Operation>& ready_queue,
+      std::size_t& count)
+  {
+#if defined(BOOST_ASIO_HAS_THREADS)
+    std::size_t state = state_.load(std::memory_order_acquire);
+    for (;;)
+    {
+      if ((state & ~flags_mask) != 0)
+      {
+        if (state_.compare_exchange_weak(state, state & flags_mask,
+              std::memory_order_acquire, std::memory_order_acquire))
+        {
+          count += atomic_op_queue<Operation>::push_reversed(
+              to_operation(state & ~flags_mask), ready_queue);
+          state &= flags_mask;
+        }
+      }
+      else if (!ready_queue.empty() || (state & shutdown_flag) != 0)
+      {
+        return !ready_queue.empty();
+      }
+      else if (state_.compare_exchange_weak(state, 0,
+            std::memory_order_release, std::memory_order_acquire))
+      {
+        return false;
+      }
+    }
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    count += atomic_op_queue<Operation>::push_reversed(
+        to_operation(state_ & ~flags_mask), ready_queue);
+    state_ &= flags_mask;
+    if (ready_queue.empty() && (state_ & shutdown_flag) == 0)
+      state_ = 0;
+    return !ready_queue.empty();
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+  }
+
+  // Shut down the strand so that it accepts no further handlers, and transfer
+  // the waiting handlers to the given queue.
+  void shutdown(op_queue<Operation>& ops)
+  {
+#if defined(BOOST_ASIO_HAS_THREADS)
+    std::size_t state = state_.load(std::memory_order_relaxed);
+    while (!state_.compare_exchange_weak(state,
+          (state & locked_flag) | shutdown_flag,
+          std::memory_order_acquire, std::memory_order_relaxed))
+    {
+    }
+#else // defined(BOOST_ASIO_HAS_THREADS)
+    std::size_t state = state_;
+    state_ = (state & locked_flag) | shutdown_flag;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+
+    atomic_op_queue<Operation>::push_reversed(
+        to_operation(state & ~flags_mask), ops);
+  }
+
+private:
+  enum
+  {
+    locked_flag = 1,
+    shutdown_flag = 2,
+    flags_mask = locked_flag | shutdown_flag
+  };
+
+  static Operation* to_operation(std::size_t state)
+  {
+    return reinterpret_cast<Operation*>(state);
+  }
+
+#if defined(BOOST_ASIO_HAS_THREADS)
+  static std::size_t load(const std::atomic<std::size_t>& state)
+  {
+    return state.load(std::memory_order_acquire);
+  }
+
+  std::atomic<std::size_t> state_;
+#else // defined(BOOST_ASIO_HAS_THREADS)
+  static std::size_t load(std::size_t state)
+  {
+    return state;
+  }
+
+  std::size_t state_;
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_STRAND_STATE_HPP
@@ -0,0 +1,91 @@
+//
+// detail/thread_affinity.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_THREAD_AFFINITY_HPP
+#define BOOST_ASIO_DETAIL_THREAD_AFFINITY_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+#include <vector>
+
+#if defined(BOOST_ASIO_WINDOWS) || defined(__CYGWIN__)
+# include <boost/asio/detail/socket_types.hpp>
+#elif defined(__linux__) && defined(BOOST_ASIO_HAS_PTHREADS)
+# include <pthread.h>
+# include <sched.h>
+#endif
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// Bind the calling thread to a single CPU. Returns false if the thread could
+// not be bound, or if thread affinity is not supported on this platform.
+inline bool bind_this_thread_to_cpu(std::size_t cpu)
+{
+#if defined(BOOST_ASIO_WINDOWS_RUNTIME)
+  (void)cpu;
+  return false;
+#elif defined(BOOST_ASIO_WINDOWS) || defined(__CYGWIN__)
+  if (cpu >= sizeof(DWORD_PTR) * 8)
+    return false;
+  DWORD_PTR mask = static_cast<DWORD_PTR>(1) << cpu;
+  return ::SetThreadAffinityMask(::GetCurrentThread(), mask) != 0;
+#elif defined(__linux__) && defined(BOOST_ASIO_HAS_PTHREADS) \
+  && defined(CPU_SETSIZE)
+  if (cpu >= CPU_SETSIZE)
+    return false;
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu, &cpus);
+  return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+  (void)cpu;
+  return false;
+#endif
+}
+
+// Bind the calling thread to a set of CPUs. Returns false if the thread could
+// not be bound, or if thread affinity is not supported on this platform.
+BOOST_ASIO_DECL bool bind_this_thread_to_cpus(
+    const std::vector<std::size_t>& cpus);
+
+// Get the CPUs on which the calling thread is permitted to run. If this cannot
+// be determined, all CPUs are assumed to be available.
+BOOST_ASIO_DECL void get_available_cpus(std::vector<std::size_t>& cpus);
+
+// Read a list of CPUs, or of NUMA nodes, from a file in the format used by
+// Linux, such as "0-3,8". Returns false if the file could not be read.
+BOOST_ASIO_DECL bool read_cpu_list(
+    const char* path, std::vector<std::size_t>& cpus);
+
+// Get the available CPUs grouped by NUMA node, omitting nodes that have no
+// available CPUs. If the NUMA topology cannot be determined, the available
+// CPUs are treated as a single node.
+BOOST_ASIO_DECL void get_numa_node_cpus(
+    std::vector<std::vector<std::size_t>>& nodes);
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#if defined(BOOST_ASIO_HEADER_ONLY)
+# include <boost/asio/detail/impl/thread_affinity.ipp>
+#endif // defined(BOOST_ASIO_HEADER_ONLY)
+
+#endif // BOOST_ASIO_DETAIL_THREAD_AFFINITY_HPP
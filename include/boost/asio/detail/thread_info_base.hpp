@@ -18,6 +18,7 @@
 #include <boost/asio/detail/config.hpp>
 #include <climits>
 #include <cstddef>
+#include <boost/asio/detail/handler_arena.hpp>
 #include <boost/asio/detail/memory.hpp>
 #include <boost/asio/detail/noncopyable.hpp>
 
@@ -103,8 +104,9 @@ public:
   enum { max_mem_index = timed_cancel_tag::end_mem_index };
 
   thread_info_base()
+    : arena_(0)
 #if !defined(BOOST_ASIO_NO_EXCEPTIONS)
-    : has_pending_exception_(0)
+    , has_pending_exception_(0)
 #endif // !defined(BOOST_ASIO_NO_EXCEPTIONS)
   {
     for (int i = 0; i < max_mem_index; ++i)
@@ -121,6 +123,18 @@ public:
       if (reusable_memory_[i])
         aligned_delete(reusable_memory_[i]);
     }
+
+    if (arena_)
+      arena_->release();
+  }
+
+  // Allocate small blocks from a per-thread arena, rather than from the
+  // reusable memory slots. Blocks allocated from the arena and deallocated on
+  // another thread are returned to this thread for reuse.
+  void enable_handler_arena()
+  {
+    if (!arena_)
+      arena_ = new handler_arena;
   }
 
   static void* allocate(thread_info_base* this_thread,
@@ -139,6 +153,10 @@ public:
   static void* allocate(Purpose, thread_info_base* this_thread,
       std::size_t size, std::size_t align = BOOST_ASIO_DEFAULT_ALIGN)
   {
+    if (this_thread && this_thread->arena_
+        && handler_arena::is_eligible(size, align))
+      return this_thread->arena_->allocate(size);
+
     std::size_t chunks = (size + chunk_size - 1) / chunk_size;
 
     if (this_thread)
@@ -183,6 +201,12 @@ public:
   static void deallocate(Purpose, thread_info_base* this_thread,
       void* pointer, std::size_t size)
   {
+    if (handler_arena::is_arena_block(pointer, size))
+    {
+      handler_arena::deallocate(this_thread ? this_thread->arena_ : 0, pointer);
+      return;
+    }
+
     if (size <= chunk_size * UCHAR_MAX)
     {
       if (this_thread)
@@ -245,7 +269,14 @@ private:
 #else // defined(BOOST_ASIO_HAS_IO_URING)
   enum { chunk_size = 4 };
 #endif // defined(BOOST_ASIO_HAS_IO_URING)
+
+  // Blocks not allocated from an arena, and smaller than the arena's maximum
+  // size, have a non-zero byte following the requested size.
+  static_assert(handler_arena::max_size <= chunk_size * UCHAR_MAX,
+      "handler_arena::max_size must fit in the chunk count");
+
   void* reusable_memory_[max_mem_index];
+  handler_arena* arena_;
 
 #if !defined(BOOST_ASIO_NO_EXCEPTIONS)
   int has_pending_exception_;
@@ -43,14 +43,29 @@ public:
   // The duration type.
   typedef typename TimeTraits::duration_type duration_type;
 
+  // An operation that waits on a timer repeatedly.
+  class periodic_op;
+
   // Per-timer data.
   class per_timer_data
   {
   public:
     per_timer_data() :
       heap_index_((std::numeric_limits<std::size_t>::max)()),
-      next_(0), prev_(0)
+      next_(0), prev_(0),
+      wheel_tick_(0), slot_next_(0), slot_prev_(0),
+      deadline_(), lazy_(false), periodic_(0)
+    {
+    }
+
+    // Set whether the timer remains in the queue when all of its operations
+    // are cancelled. A lazy timer that is waited on again with a later expiry
+    // time keeps its position in the queue, and is moved only when that
+    // position is reached. A lazy timer must be made non-lazy before it is
+    // cancelled for the last time.
+    void set_lazy(bool lazy)
     {
+      lazy_ = lazy;
     }
 
   private:
@@ -59,20 +74,109 @@ public:
     // The operations waiting on the timer.
     op_queue<wait_op> op_queue_;
 
-    // The index of the timer in the heap.
+    // The index of the timer in the heap, or of its slot in the wheel.
     std::size_t heap_index_;
 
     // Pointers to adjacent timers in a linked list.
     per_timer_data* next_;
     per_timer_data* prev_;
+
+    // The tick at which the timer expires, when the queue is a timer wheel.
+    uint64_t wheel_tick_;
+
+    // Pointers to adjacent timers in the same wheel slot.
+    per_timer_data* slot_next_;
+    per_timer_data* slot_prev_;
+
+    // The time at which the timer's operations complete. This may be later
+    // than the timer's position in the queue if the timer is lazy.
+    time_type deadline_;
+
+    // Whether the timer remains in the queue when its operations are
+    // cancelled.
+    bool lazy_;
+
+    // The periodic operation waiting on the timer, if any.
+    periodic_op* periodic_;
+  };
+
+  // An operation that waits on a timer repeatedly. The operation is queued
+  // using its own entry, rather than the timer's, so that it can be queued
+  // again after each expiry without affecting the timer's other operations.
+  class periodic_op : public wait_op
+  {
+  public:
+    // Detach the operation from its timer when the operation is destroyed
+    // without being cancelled, such as on shutdown.
+    void abandon()
+    {
+      if (timer_)
+      {
+        timer_->periodic_ = 0;
+        timer_ = 0;
+      }
+    }
+
+    // Whether the operation was cancelled while it was being completed, and
+    // so must complete with operation_aborted.
+    bool aborted() const
+    {
+      return aborted_;
+    }
+
+  protected:
+    periodic_op(func_type func, const time_type& expiry,
+        const duration_type& interval)
+      : wait_op(func),
+        timer_(0),
+        expiry_(expiry),
+        interval_(interval),
+        rescheduled_(false),
+        aborted_(false)
+    {
+    }
+
+  private:
+    friend class timer_queue;
+
+    // The queue entry for the operation.
+    per_timer_data entry_;
+
+    // The timer to which the operation is attached, or 0 once the operation
+    // has been cancelled.
+    per_timer_data* timer_;
+
+    // The time at which the operation next completes.
+    time_type expiry_;
+
+    // The time between successive completions.
+    duration_type interval_;
+
+    // Whether the expiry time was changed while the operation was being
+    // completed, in which case it is used as the next expiry time.
+    bool rescheduled_;
+
+    // Whether the operation was cancelled while it was being completed.
+    bool aborted_;
   };
 
   // Constructor.
-  timer_queue(const Allocator& alloc, std::size_t heap_reserve)
+  timer_queue(const Allocator& alloc, std::size_t heap_reserve,
+      long wheel_tick_usec = 0)
     : timers_(),
-      heap_(alloc)
+      heap_(alloc),
+      wheel_tick_usec_(wheel_tick_usec > 0 ? wheel_tick_usec : 0),
+      wheel_origin_(TimeTraits::now()),
+      wheel_current_(0),
+      wheel_slots_(alloc)
   {
-    if (heap_reserve > 0)
+    if (wheel_tick_usec_ > 0)
+    {
+      wheel_slots_.resize(wheel_expired + 1);
+      for (std::size_t level = 0; level < wheel_levels; ++level)
+        wheel_occupied_[level] = 0;
+    }
+    else if (heap_reserve > 0)
       heap_.reserve(heap_reserve);
   }
 
@@ -81,14 +185,26 @@ public:
   // function call may need to be interrupted and restarted.
   bool enqueue_timer(const time_type& time, per_timer_data& timer, wait_op* op)
   {
+    bool earliest = false;
+
     // Enqueue the timer object.
     if (timer.prev_ == 0 && &timer != timers_)
     {
+      timer.deadline_ = time;
+
       if (this->is_positive_infinity(time))
       {
         // No heap entry is required for timers that never expire.
         timer.heap_index_ = (std::numeric_limits<std::size_t>::max)();
       }
+      else if (wheel_tick_usec_ > 0)
+      {
+        // Put the new timer in the slot for its expiry tick.
+        timer.wheel_tick_ = to_wheel_tick(time, true);
+        earliest = wheel_slots_[wheel_expired] == 0
+          && timer.wheel_tick_ < next_wheel_tick();
+        wheel_insert(timer);
+      }
       else
       {
         // Put the new timer at the correct position in the heap. This is done
@@ -97,6 +213,7 @@ public:
         heap_entry entry = { time, &timer };
         heap_.push_back(entry);
         up_heap(heap_.size() - 1);
+        earliest = timer.heap_index_ == 0;
       }
 
       // Insert the new timer into the linked list of active timers.
@@ -106,12 +223,95 @@ public:
         timers_->prev_ = &timer;
       timers_ = &timer;
     }
+    else if (timer.op_queue_.empty())
+    {
+      // A lazy timer that is still in the queue. Its position only needs to
+      // change if the new expiry time is earlier.
+      timer.deadline_ = time;
+      earliest = update_timer(timer, time, false);
+    }
 
     // Enqueue the individual timer operation.
     timer.op_queue_.push(op);
 
     // Interrupt reactor only if newly added timer is first to expire.
-    return timer.heap_index_ == 0 && timer.op_queue_.front() == op;
+    return earliest;
+  }
+
+  // Attach a periodic operation to a timer and add it to the queue at the
+  // operation's first expiry time. Any periodic operation already attached to
+  // the timer is cancelled. Returns true if the operation is the earliest in
+  // the queue.
+  bool enqueue_periodic(per_timer_data& timer,
+      periodic_op* op, op_queue<operation>& ops)
+  {
+    detach_periodic(timer, ops);
+    timer.periodic_ = op;
+    op->timer_ = &timer;
+    return enqueue_timer(op->expiry_, op->entry_, op);
+  }
+
+  // Add a periodic operation that has completed to the queue at its next
+  // expiry time. If an expiry has been missed, the next expiry time is one
+  // interval after the current time. If the operation was cancelled while it
+  // was being completed, it is added to expire immediately, and is marked as
+  // aborted. Sets earliest to whether the operation is the earliest in the
+  // queue.
+  void requeue_periodic(periodic_op* op, bool& earliest)
+  {
+    if (!op->timer_)
+    {
+      op->aborted_ = true;
+      earliest = enqueue_timer(TimeTraits::now(), op->entry_, op);
+      return;
+    }
+
+    if (op->rescheduled_)
+      op->rescheduled_ = false;
+    else
+    {
+      op->expiry_ = TimeTraits::add(op->expiry_, op->interval_);
+      const time_type now = TimeTraits::now();
+      if (TimeTraits::less_than(op->expiry_, now))
+        op->expiry_ = TimeTraits::add(now, op->interval_);
+    }
+
+    earliest = enqueue_timer(op->expiry_, op->entry_, op);
+  }
+
+  // Change the expiry time of a timer's operations, including any periodic
+  // operation, without cancelling them. Returns true if the timer is now the
+  // earliest in the queue.
+  bool reschedule_timer(const time_type& time, per_timer_data& timer)
+  {
+    bool earliest = false;
+    if (timer.prev_ != 0 || &timer == timers_)
+    {
+      // A lazy timer keeps its position if the new expiry time is later.
+      bool later = TimeTraits::less_than(timer.deadline_, time);
+      timer.deadline_ = time;
+      if (!later)
+        earliest = update_timer(timer, time, false);
+      else if (!timer.lazy_)
+        update_timer(timer, time, true);
+    }
+
+    if (periodic_op* op = timer.periodic_)
+    {
+      op->expiry_ = time;
+      per_timer_data& entry = op->entry_;
+      if (entry.prev_ != 0 || &entry == timers_)
+      {
+        bool later = TimeTraits::less_than(entry.deadline_, time);
+        entry.deadline_ = time;
+        if (update_timer(entry, time, later) && !later)
+          earliest = true;
+      }
+      else
+        op->rescheduled_ = true;
+    }
+
+    return earliest;
   }
 
   // Whether there are no timers in the queue.
@@ -123,6 +323,15 @@ public:
   // Get the time for the timer that is earliest in the queue.
   virtual long wait_duration_msec(long max_duration) const
   {
+    if (wheel_tick_usec_ > 0)
+    {
+      int64_t usec = wheel_wait_usec();
+      if (usec < 0)
+        return max_duration;
+      int64_t msec = (usec + 999) / 1000;
+      return msec > max_duration ? max_duration : static_cast<long>(msec);
+    }
+
     if (heap_.empty())
       return max_duration;
 
@@ -135,6 +344,14 @@ public:
   // Get the time for the timer that is earliest in the queue.
   virtual long wait_duration_usec(long max_duration) const
   {
+    if (wheel_tick_usec_ > 0)
+    {
+      int64_t usec = wheel_wait_usec();
+      if (usec < 0)
+        return max_duration;
+      return usec > max_duration ? max_duration : static_cast<long>(usec);
+    }
+
     if (heap_.empty())
       return max_duration;
 
@@ -147,12 +364,41 @@ public:
   // Dequeue all timers not later than the current time.
   virtual void get_ready_timers(op_queue<operation>& ops)
   {
-    if (!heap_.empty())
+    if (wheel_tick_usec_ > 0)
+    {
+      const time_type now = TimeTraits::now();
+      wheel_advance(to_wheel_tick(now, false));
+      while (per_timer_data* timer = wheel_slots_[wheel_expired])
+      {
+        if (!timer->op_queue_.empty()
+            && TimeTraits::less_than(now, timer->deadline_))
+        {
+          update_timer(*timer, timer->deadline_, true);
+          continue;
+        }
+
+        while (wait_op* op = timer->op_queue_.front())
+        {
+          timer->op_queue_.pop();
+          op->ec_ = boost::system::error_code();
+          ops.push(op);
+        }
+        remove_timer(*timer);
+      }
+    }
+    else if (!heap_.empty())
     {
       const time_type now = TimeTraits::now();
       while (!heap_.empty() && !TimeTraits::less_than(now, heap_[0].time_))
       {
         per_timer_data* timer = heap_[0].timer_;
+        if (!timer->op_queue_.empty()
+            && TimeTraits::less_than(now, timer->deadline_))
+        {
+          update_timer(*timer, timer->deadline_, true);
+          continue;
+        }
+
         while (wait_op* op = timer->op_queue_.front())
         {
           timer->op_queue_.pop();
@@ -174,9 +420,18 @@ public:
       ops.push(timer->op_queue_);
       timer->next_ = 0;
       timer->prev_ = 0;
+      timer->slot_next_ = 0;
+      timer->slot_prev_ = 0;
     }
 
     heap_.clear();
+    if (wheel_tick_usec_ > 0)
+    {
+      for (std::size_t i = 0; i < wheel_slots_.size(); ++i)
+        wheel_slots_[i] = 0;
+      for (std::size_t level = 0; level < wheel_levels; ++level)
+        wheel_occupied_[level] = 0;
+    }
   }
 
   // Cancel and dequeue operations for the given timer.
@@ -194,9 +449,11 @@ public:
         ops.push(op);
         ++num_cancelled;
       }
-      if (timer.op_queue_.empty())
+      if (timer.op_queue_.empty() && !timer.lazy_)
         remove_timer(timer);
     }
+    if (num_cancelled != max_cancelled && detach_periodic(timer, ops))
+      ++num_cancelled;
     return num_cancelled;
   }
 
@@ -219,7 +476,7 @@ public:
           other_ops.push(op);
       }
       timer->op_queue_.push(other_ops);
-      if (timer->op_queue_.empty())
+      if (timer->op_queue_.empty() && !timer->lazy_)
         remove_timer(*timer);
     }
   }
@@ -227,7 +484,17 @@ public:
   // Move operations from one timer to another, empty timer.
   void move_timer(per_timer_data& target, per_timer_data& source)
   {
+    // An empty lazy timer may still be in the queue.
+    if (target.prev_ != 0 || &target == timers_)
+      remove_timer(target);
+
     target.op_queue_.push(source.op_queue_);
+    target.deadline_ = source.deadline_;
+
+    target.periodic_ = source.periodic_;
+    source.periodic_ = 0;
+    if (target.periodic_)
+      target.periodic_->timer_ = &target;
 
     target.heap_index_ = source.heap_index_;
     source.heap_index_ = (std::numeric_limits<std::size_t>::max)();
@@ -235,6 +502,21 @@ public:
     if (target.heap_index_ < heap_.size())
       heap_[target.heap_index_].timer_ = &target;
 
+    target.wheel_tick_ = source.wheel_tick_;
+    if (target.heap_index_ < wheel_slots_.size())
+    {
+      if (wheel_slots_[target.heap_index_] == &source)
+        wheel_slots_[target.heap_index_] = &target;
+      if (source.slot_prev_)
+        source.slot_prev_->slot_next_ = &target;
+      if (source.slot_next_)
+        source.slot_next_->slot_prev_ = &target;
+      target.slot_next_ = source.slot_next_;
+      target.slot_prev_ = source.slot_prev_;
+      source.slot_next_ = 0;
+      source.slot_prev_ = 0;
+    }
+
     if (timers_ == &source)
       timers_ = &target;
     if (source.prev_)
@@ -248,6 +530,29 @@ public:
   }
 
 private:
+  // Cancel the periodic operation attached to a timer, if any. An operation
+  // that is in the queue is dequeued. Otherwise, the operation is being
+  // completed and is not queued again. Returns true if there was a periodic
+  // operation.
+  bool detach_periodic(per_timer_data& timer, op_queue<operation>& ops)
+  {
+    periodic_op* op = timer.periodic_;
+    if (!op)
+      return false;
+
+    timer.periodic_ = 0;
+    op->timer_ = 0;
+    per_timer_data& entry = op->entry_;
+    if (entry.prev_ != 0 || &entry == timers_)
+    {
+      entry.op_queue_.pop();
+      op->ec_ = boost::asio::error::operation_aborted;
+      ops.push(op);
+      remove_timer(entry);
+    }
+    return true;
+  }
+
   // Move the item at the given index up the heap to its correct position.
   void up_heap(std::size_t index)
   {
@@ -289,12 +594,64 @@ private:
     heap_[index2].timer_->heap_index_ = index2;
   }
 
+  // Move a timer that is in the queue to the position for the given time. If
+  // the later argument is false, the timer is moved only if the time is
+  // earlier than its current position. Returns true if the timer is now the
+  // earliest in the queue.
+  bool update_timer(per_timer_data& timer, const time_type& time, bool later)
+  {
+    if (wheel_tick_usec_ > 0)
+    {
+      uint64_t tick = to_wheel_tick(time, true);
+      bool in_wheel = timer.heap_index_ < wheel_slots_.size();
+      if (in_wheel && !later && tick >= timer.wheel_tick_)
+        return false;
+
+      bool earliest = !later && wheel_slots_[wheel_expired] == 0
+        && tick < next_wheel_tick();
+      wheel_remove(timer);
+      if (!this->is_positive_infinity(time))
+      {
+        timer.wheel_tick_ = tick;
+        wheel_insert(timer);
+      }
+      return earliest;
+    }
+
+    std::size_t index = timer.heap_index_;
+    if (index < heap_.size())
+    {
+      if (!later && !TimeTraits::less_than(time, heap_[index].time_))
+        return false;
+
+      heap_[index].time_ = time;
+      if (later)
+        down_heap(index);
+      else
+        up_heap(index);
+    }
+    else if (!this->is_positive_infinity(time))
+    {
+      // The timer was previously queued to never expire.
+      timer.heap_index_ = heap_.size();
+      heap_entry entry = { time, &timer };
+      heap_.push_back(entry);
+      up_heap(heap_.size() - 1);
+    }
+
+    return timer.heap_index_ == 0;
+  }
+
   // Remove a timer from the heap and list of timers.
   void remove_timer(per_timer_data& timer)
   {
     // Remove the timer from the heap.
     std::size_t index = timer.heap_index_;
-    if (!heap_.empty() && index < heap_.size())
+    if (wheel_tick_usec_ > 0)
+    {
+      wheel_remove(timer);
+    }
+    else if (!heap_.empty() && index < heap_.size())
     {
       if (index == heap_.size() - 1)
       {
@@ -325,6 +682,193 @@ private:
     timer.prev_ = 0;
   }
 
+  // The timer wheel has a number of levels, each consisting of a fixed number
+  // of slots. A slot at level 0 holds the timers that expire at a single tick,
+  // and a slot at each higher level covers all the slots at the level below.
+  // The timers in a slot at a higher level are moved to the lower levels when
+  // the current tick reaches the start of the slot, so that timers are
+  // inserted, cancelled and rescheduled in constant time.
+  enum
+  {
+    wheel_bits = 6,
+    wheel_slots = 1 << wheel_bits,
+    wheel_levels = 6,
+
+    // The index of the list of expired timers, which follows the slots.
+    wheel_expired = wheel_levels * wheel_slots
+  };
+
+  // Convert a time to a tick of the wheel. An expiry time is converted to the
+  // tick after the one containing it, since the duration in microseconds may
+  // be truncated, so that timers never expire early.
+  uint64_t to_wheel_tick(const time_type& time, bool expiry) const
+  {
+    int64_t usec = TimeTraits::to_posix_duration(
+        TimeTraits::subtract(time, wheel_origin_)).total_microseconds();
+    if (usec < 0)
+      return 0;
+    return static_cast<uint64_t>(usec / wheel_tick_usec_ + (expiry ? 1 : 0));
+  }
+
+  // Get the index of the lowest set bit in a non-zero value.
+  static std::size_t lowest_bit(uint64_t value)
+  {
+#if defined(__GNUC__)
+    return static_cast<std::size_t>(__builtin_ctzll(value));
+#else // defined(__GNUC__)
+    std::size_t bit = 0;
+    while ((value & 1) == 0)
+      value >>= 1, ++bit;
+    return bit;
+#endif // defined(__GNUC__)
+  }
+
+  // Get the next tick after the current tick at which timers may expire or
+  // move between levels, or the maximum value if the wheel is empty.
+  uint64_t next_wheel_tick() const
+  {
+    uint64_t next = (std::numeric_limits<uint64_t>::max)();
+    for (std::size_t level = 0; level < wheel_levels; ++level)
+    {
+      if (uint64_t occupied = wheel_occupied_[level])
+      {
+        // Rotate the occupied slots so that the slot following the one that
+        // contains the current tick is first. The timers in a slot expire, or
+        // move to the lower levels, at the start of the slot.
+        std::size_t bits = wheel_bits * level;
+        uint64_t current = wheel_current_ >> bits;
+        std::size_t shift = static_cast<std::size_t>(
+            current + 1) & (wheel_slots - 1);
+        if (shift != 0)
+          occupied = (occupied >> shift) | (occupied << (wheel_slots - shift));
+        uint64_t tick = (current + 1 + lowest_bit(occupied)) << bits;
+        if (tick < next)
+          next = tick;
+      }
+    }
+    return next;
+  }
+
+  // Get the time to wait until the next tick at which timers may expire, or
+  // a negative value if the wheel is empty.
+  int64_t wheel_wait_usec() const
+  {
+    if (wheel_slots_[wheel_expired])
+      return 0;
+
+    uint64_t next = next_wheel_tick();
+    if (next == (std::numeric_limits<uint64_t>::max)())
+      return -1;
+
+    int64_t now_usec = TimeTraits::to_posix_duration(
+        TimeTraits::subtract(TimeTraits::now(),
+          wheel_origin_)).total_microseconds();
+    int64_t usec = static_cast<int64_t>(next) * wheel_tick_usec_ - now_usec;
+    return usec > 0 ? usec : 0;
+  }
+
+  // Add a timer to the slot for its expiry tick, relative to the current tick.
+  void wheel_insert(per_timer_data& timer)
+  {
+    std::size_t index = wheel_expired;
+    if (timer.wheel_tick_ > wheel_current_)
+    {
+      // Timers beyond the range of the wheel wait in the last slot of the
+      // highest level, and are inserted again when that slot is reached.
+      const uint64_t range = static_cast<uint64_t>(1)
+        << (wheel_bits * wheel_levels);
+      uint64_t tick = timer.wheel_tick_;
+      if (tick - wheel_current_ >= range)
+        tick = wheel_current_ + range - 1;
+
+      std::size_t level = 0;
+      while (level + 1 < wheel_levels && tick - wheel_current_
+          >= (static_cast<uint64_t>(1) << (wheel_bits * (level + 1))))
+        ++level;
+
+      std::size_t slot = static_cast<std::size_t>(
+          tick >> (wheel_bits * level)) & (wheel_slots - 1);
+      wheel_occupied_[level] |= static_cast<uint64_t>(1) << slot;
+      index = level * wheel_slots + slot;
+    }
+
+    timer.heap_index_ = index;
+    timer.slot_prev_ = 0;
+    timer.slot_next_ = wheel_slots_[index];
+    if (timer.slot_next_)
+      timer.slot_next_->slot_prev_ = &timer;
+    wheel_slots_[index] = &timer;
+  }
+
+  // Remove a timer from its slot.
+  void wheel_remove(per_timer_data& timer)
+  {
+    std::size_t index = timer.heap_index_;
+    if (index >= wheel_slots_.size())
+      return;
+
+    if (wheel_slots_[index] == &timer)
+      wheel_slots_[index] = timer.slot_next_;
+    if (timer.slot_prev_)
+      timer.slot_prev_->slot_next_ = timer.slot_next_;
+    if (timer.slot_next_)
+      timer.slot_next_->slot_prev_ = timer.slot_prev_;
+    timer.slot_next_ = 0;
+    timer.slot_prev_ = 0;
+    timer.heap_index_ = (std::numeric_limits<std::size_t>::max)();
+
+    if (index < wheel_expired && wheel_slots_[index] == 0)
+    {
+      wheel_occupied_[index / wheel_slots] &=
+        ~(static_cast<uint64_t>(1) << (index % wheel_slots));
+    }
+  }
+
+  // Remove all timers from a slot and insert them again.
+  void wheel_reinsert(std::size_t index)
+  {
+    per_timer_data* timer = wheel_slots_[index];
+    wheel_slots_[index] = 0;
+    wheel_occupied_[index / wheel_slots] &=
+      ~(static_cast<uint64_t>(1) << (index % wheel_slots));
+    while (timer)
+    {
+      per_timer_data* next = timer->slot_next_;
+      wheel_insert(*timer);
+      timer = next;
+    }
+  }
+
+  // Advance the current tick, moving timers down the levels as their slots
+  // are reached, and moving the timers that have expired to the expired list.
+  void wheel_advance(uint64_t tick)
+  {
+    while (wheel_current_ < tick)
+    {
+      uint64_t next = next_wheel_tick();
+      if (next > tick)
+      {
+        wheel_current_ = tick;
+        break;
+      }
+
+      wheel_current_ = next;
+      for (std::size_t level = 1; level < wheel_levels; ++level)
+      {
+        // A slot at this level is reached only when all lower levels have
+        // completed a rotation.
+        if ((next & ((static_cast<uint64_t>(1)
+                  << (wheel_bits * level)) - 1)) != 0)
+          break;
+        wheel_reinsert(level * wheel_slots + (static_cast<std::size_t>(
+                next >> (wheel_bits * level)) & (wheel_slots - 1)));
+      }
+
+      // The timers in the current tick's slot have expired.
+      wheel_reinsert(static_cast<std::size_t>(next) & (wheel_slots - 1));
+    }
+  }
+
   // Determine if the specified absolute time is positive infinity.
   template <typename Time_Type>
   static bool is_positive_infinity(const Time_Type&)
@@ -384,6 +928,25 @@ private:
   std::vector<heap_entry,
     typename std::allocator_traits<Allocator>::template
       rebind_alloc<heap_entry>> heap_;
+
+  // The duration of a tick of the timer wheel, in microseconds, or 0 if the
+  // timers are kept in the heap.
+  const long wheel_tick_usec_;
+
+  // The time at which tick 0 of the timer wheel starts.
+  const time_type wheel_origin_;
+
+  // The most recent tick for which timers have been expired.
+  uint64_t wheel_current_;
+
+  // The first timer in each slot of the wheel, followed by the first expired
+  // timer.
+  std::vector<per_timer_data*,
+    typename std::allocator_traits<Allocator>::template
+      rebind_alloc<per_timer_data*>> wheel_slots_;
+
+  // The slots of each level that contain timers.
+  uint64_t wheel_occupied_[wheel_levels];
 };
 
 } // namespace detail
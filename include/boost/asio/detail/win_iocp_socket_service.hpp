@@ -20,8 +20,10 @@
 #if defined(BOOST_ASIO_HAS_IOCP)
 
 #include <cstring>
+#include <boost/asio/datagram_slot.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/execution_context.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/asio/detail/bind_handler.hpp>
 #include <boost/asio/detail/buffer_sequence_adapter.hpp>
@@ -510,6 +512,59 @@ public:
     }
   }
 
+  // Start an asynchronous send of a batch of datagrams. Not supported by
+  // the I/O completion port backend, which has no batched equivalent.
+  template <typename Handler, typename IoExecutor>
+  void async_send_to_many(implementation_type&,
+      datagram_slot<const_buffer, endpoint_type>*, std::size_t,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    const std::size_t datagrams_transferred = 0;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, datagrams_transferred));
+  }
+
+  // Start an asynchronous receive of a batch of datagrams. Not supported by
+  // the I/O completion port backend, which has no batched equivalent.
+  template <typename Handler, typename IoExecutor>
+  void async_receive_from_many(implementation_type&,
+      datagram_slot<mutable_buffer, endpoint_type>*, std::size_t,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    const std::size_t datagrams_transferred = 0;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, datagrams_transferred));
+  }
+
+  // Start an asynchronous send of data split into datagrams of the specified
+  // segment size. Segmentation offload is not supported on this platform.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_send_to_segmented(implementation_type&,
+      const ConstBufferSequence&, const endpoint_type&, std::size_t,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    const std::size_t bytes_transferred = 0;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, bytes_transferred));
+  }
+
+  // Start an asynchronous receive of data coalesced from several datagrams.
+  // Receive offload is not supported on this platform.
+  template <typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_receive_from_coalesced(implementation_type&,
+      const MutableBufferSequence&, endpoint_type&, std::size_t&,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    const std::size_t bytes_transferred = 0;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, bytes_transferred));
+  }
+
   // Accept a new connection.
   template <typename Socket>
   boost::system::error_code accept(implementation_type& impl, Socket& peer,
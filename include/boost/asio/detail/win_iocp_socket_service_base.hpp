@@ -22,6 +22,8 @@
 #include <boost/asio/associated_cancellation_slot.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/execution_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/provided_buffer_ring.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/asio/detail/bind_handler.hpp>
 #include <boost/asio/detail/buffer_sequence_adapter.hpp>
@@ -34,6 +36,7 @@
 #include <boost/asio/detail/select_reactor.hpp>
 #include <boost/asio/detail/socket_holder.hpp>
 #include <boost/asio/detail/socket_ops.hpp>
+#include <boost/asio/detail/socket_send_then_receive_op.hpp>
 #include <boost/asio/detail/socket_types.hpp>
 #include <boost/asio/detail/win_iocp_io_context.hpp>
 #include <boost/asio/detail/win_iocp_null_buffers_op.hpp>
@@ -401,6 +404,18 @@ public:
     p.v = p.p = 0;
   }
 
+  // Start an asynchronous receive into a buffer selected from a ring of
+  // provided buffers. Not supported by the I/O completion port backend, which
+  // requires a buffer to be supplied when the operation is started.
+  template <typename Handler, typename IoExecutor>
+  void async_receive(base_implementation_type&, provided_buffer_ring_base&,
+      socket_base::message_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    boost::system::error_code ec = boost::asio::error::operation_not_supported;
+    boost::asio::post(io_ex, detail::bind_handler(
+          handler, ec, provided_buffer()));
+  }
+
   // Wait until data can be received without blocking.
   template <typename Handler, typename IoExecutor>
   void async_receive(base_implementation_type& impl,
@@ -439,6 +454,23 @@ public:
     }
   }
 
+  // Start an asynchronous send followed by an asynchronous receive. The
+  // receive is started once all of the data has been sent.
+  template <typename ConstBufferSequence, typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_send_then_receive(base_implementation_type& impl,
+      const ConstBufferSequence& send_buffers,
+      const MutableBufferSequence& receive_buffers,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    typedef socket_send_then_receive_op<win_iocp_socket_service_base,
+        base_implementation_type, ConstBufferSequence,
+        MutableBufferSequence, Handler, IoExecutor> op;
+    op o(*this, impl, send_buffers, receive_buffers, flags, handler, io_ex);
+    async_send(impl, send_buffers, flags, o, io_ex);
+  }
+
   // Receive some data with associated flags. Returns the number of bytes
   // received.
   template <typename MutableBufferSequence>
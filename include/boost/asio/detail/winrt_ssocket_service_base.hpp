@@ -25,6 +25,7 @@
 #include <boost/asio/socket_base.hpp>
 #include <boost/asio/detail/buffer_sequence_adapter.hpp>
 #include <boost/asio/detail/memory.hpp>
+#include <boost/asio/detail/socket_send_then_receive_op.hpp>
 #include <boost/asio/detail/socket_types.hpp>
 #include <boost/asio/detail/winrt_async_manager.hpp>
 #include <boost/asio/detail/winrt_socket_recv_op.hpp>
@@ -282,6 +283,23 @@ public:
         detail::bind_handler(handler, ec, bytes_transferred));
   }
 
+  // Start an asynchronous send followed by an asynchronous receive. The
+  // receive is started once all of the data has been sent.
+  template <typename ConstBufferSequence, typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_send_then_receive(base_implementation_type& impl,
+      const ConstBufferSequence& send_buffers,
+      const MutableBufferSequence& receive_buffers,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    typedef socket_send_then_receive_op<winrt_ssocket_service_base,
+        base_implementation_type, ConstBufferSequence,
+        MutableBufferSequence, Handler, IoExecutor> op;
+    op o(*this, impl, send_buffers, receive_buffers, flags, handler, io_ex);
+    async_send(impl, send_buffers, flags, o, io_ex);
+  }
+
 protected:
   // Helper function to obtain endpoints associated with the connection.
   BOOST_ASIO_DECL std::size_t do_get_endpoint(
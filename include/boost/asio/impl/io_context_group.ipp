@@ -0,0 +1,192 @@
+//
+// impl/io_context_group.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_IMPL_IO_CONTEXT_GROUP_IPP
+#define BOOST_ASIO_IMPL_IO_CONTEXT_GROUP_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_THREADS)
+
+#include <exception>
+#include <vector>
+#include <boost/asio/config.hpp>
+#include <boost/asio/io_context_group.hpp>
+#include <boost/asio/detail/event.hpp>
+#include <boost/asio/detail/mutex.hpp>
+#include <boost/asio/detail/thread_affinity.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+struct io_context_group::thread_function
+{
+  io_context* io_context_;
+  int* cpu_;
+  detail::mutex* mutex_;
+  detail::event* event_;
+  std::size_t* bound_threads_;
+
+  void operator()()
+  {
+    if (*cpu_ >= 0)
+    {
+      // A thread that cannot be bound is recorded as unbound, so that the CPU
+      // is not used for steering connections to the shard.
+      if (!detail::bind_this_thread_to_cpu(static_cast<std::size_t>(*cpu_)))
+        *cpu_ = -1;
+
+      detail::mutex::scoped_lock lock(*mutex_);
+      ++*bound_threads_;
+      event_->signal_all(lock);
+    }
+
+#if !defined(BOOST_ASIO_NO_EXCEPTIONS)
+    try
+    {
+#endif// !defined(BOOST_ASIO_NO_EXCEPTIONS)
+      io_context_->run();
+#if !defined(BOOST_ASIO_NO_EXCEPTIONS)
+    }
+    catch (...)
+    {
+      std::terminate();
+    }
+#endif// !defined(BOOST_ASIO_NO_EXCEPTIONS)
+  }
+};
+
+struct io_context_group::binding_wait
+{
+  ~binding_wait()
+  {
+    detail::mutex::scoped_lock lock(*mutex_);
+    while (*bound_threads_ != *binding_threads_)
+    {
+      event_->clear(lock);
+      event_->wait(lock);
+    }
+  }
+
+  detail::mutex* mutex_;
+  detail::event* event_;
+  std::size_t* binding_threads_;
+  std::size_t* bound_threads_;
+};
+
+io_context_group::io_context_group(std::size_t num_shards, bool pin_threads)
+  : threads_(std::allocator<void>()),
+    next_io_context_(0)
+{
+  start(num_shards, pin_threads, config_from_string(
+        "scheduler.concurrency_hint=1\n"
+        "scheduler.injection_queue=1"));
+}
+
+io_context_group::io_context_group(std::size_t num_shards, bool pin_threads,
+    const execution_context::service_maker& initial_services)
+  : threads_(std::allocator<void>()),
+    next_io_context_(0)
+{
+  start(num_shards, pin_threads, initial_services);
+}
+
+io_context_group::~io_context_group()
+{
+  stop();
+  join();
+}
+
+io_context& io_context_group::next_io_context() noexcept
+{
+  std::size_t index = static_cast<std::size_t>(next_io_context_++);
+  return *io_contexts_[index % io_contexts_.size()];
+}
+
+void io_context_group::start(std::size_t num_shards, bool pin_threads,
+    const execution_context::service_maker& initial_services)
+{
+  if (num_shards == 0)
+    num_shards = 1;
+
+  // Threads are bound only to the CPUs in the process's affinity mask.
+  std::vector<std::size_t> available_cpus;
+  if (pin_threads)
+    detail::get_available_cpus(available_cpus);
+
+  io_contexts_.reserve(num_shards);
+  cpus_.reserve(num_shards);
+  work_.reserve(num_shards);
+  for (std::size_t i = 0; i < num_shards; ++i)
+  {
+    io_contexts_.emplace_back(new io_context(initial_services));
+    cpus_.push_back(available_cpus.empty() ? -1 : static_cast<int>(
+          available_cpus[i % available_cpus.size()]));
+    work_.emplace_back(io_contexts_.back()->get_executor());
+  }
+
+  // Wait until the threads have been bound, so that the CPUs reported by cpu()
+  // do not change once the group has been constructed. The wait also takes
+  // place if a thread cannot be created, as the threads already started refer
+  // to these variables.
+  detail::mutex mutex;
+  detail::event event;
+  std::size_t binding_threads = 0;
+  std::size_t bound_threads = 0;
+  binding_wait on_exit = { &mutex, &event, &binding_threads, &bound_threads };
+  (void)on_exit;
+
+  for (std::size_t i = 0; i < num_shards; ++i)
+  {
+    bool binding = cpus_[i] >= 0;
+    thread_function f = { io_contexts_[i].get(),
+      &cpus_[i], &mutex, &event, &bound_threads };
+    threads_.create_thread(f);
+
+    if (binding)
+    {
+      detail::mutex::scoped_lock lock(mutex);
+      ++binding_threads;
+    }
+  }
+}
+
+void io_context_group::stop()
+{
+  for (std::size_t i = 0; i < io_contexts_.size(); ++i)
+    io_contexts_[i]->stop();
+}
+
+void io_context_group::join()
+{
+  for (std::size_t i = 0; i < work_.size(); ++i)
+    work_[i].reset();
+  threads_.join();
+}
+
+void io_context_group::wait()
+{
+  join();
+}
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_THREADS)
+
+#endif // BOOST_ASIO_IMPL_IO_CONTEXT_GROUP_IPP
@@ -29,6 +29,7 @@
 #include <boost/asio/impl/execution_context.ipp>
 #include <boost/asio/impl/executor.ipp>
 #include <boost/asio/impl/io_context.ipp>
+#include <boost/asio/impl/io_context_group.ipp>
 #include <boost/asio/impl/multiple_exceptions.ipp>
 #include <boost/asio/impl/serial_port_base.ipp>
 #include <boost/asio/impl/system_context.ipp>
@@ -63,6 +64,7 @@
 #include <boost/asio/detail/impl/socket_select_interrupter.ipp>
 #include <boost/asio/detail/impl/strand_executor_service.ipp>
 #include <boost/asio/detail/impl/strand_service.ipp>
+#include <boost/asio/detail/impl/thread_affinity.ipp>
 #include <boost/asio/detail/impl/thread_context.ipp>
 #include <boost/asio/detail/impl/throw_error.ipp>
 #include <boost/asio/detail/impl/timer_queue_set.ipp>
@@ -17,7 +17,10 @@
 
 #include <boost/asio/detail/config.hpp>
 #include <stdexcept>
+#include <vector>
+#include <boost/asio/config.hpp>
 #include <boost/asio/thread_pool.hpp>
+#include <boost/asio/detail/thread_affinity.hpp>
 #include <boost/asio/detail/throw_exception.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
@@ -28,9 +31,13 @@ namespace asio {
 struct thread_pool::thread_function
 {
   detail::scheduler* scheduler_;
+  std::vector<std::size_t> cpus_;
 
   void operator()()
   {
+    if (!cpus_.empty())
+      detail::bind_this_thread_to_cpus(cpus_);
+
 #if !defined(BOOST_ASIO_NO_EXCEPTIONS)
     try
     {
@@ -108,8 +115,39 @@ thread_pool::~thread_pool()
 void thread_pool::start()
 {
   scheduler_.work_started();
-  thread_function f = { &scheduler_ };
-  threads_.create_threads(f, static_cast<std::size_t>(num_threads_));
+
+  std::size_t num_threads = static_cast<std::size_t>(num_threads_);
+  bool pin_threads = config(*this).get("thread_pool", "pin_threads", false);
+  bool numa_nodes = config(*this).get("thread_pool", "numa_nodes", false);
+  if (!pin_threads && !numa_nodes)
+  {
+    thread_function f = { &scheduler_, std::vector<std::size_t>() };
+    threads_.create_threads(f, num_threads);
+    return;
+  }
+
+  std::vector<std::vector<std::size_t>> nodes(1);
+  if (numa_nodes)
+    detail::get_numa_node_cpus(nodes);
+  else
+    detail::get_available_cpus(nodes[0]);
+
+  for (std::size_t i = 0; i < num_threads; ++i)
+  {
+    // Divide the threads between the nodes in contiguous blocks, so that
+    // threads with adjacent indexes share a node.
+    std::size_t node = i * nodes.size() / num_threads;
+    std::size_t first_in_node =
+      (node * num_threads + nodes.size() - 1) / nodes.size();
+    const std::vector<std::size_t>& node_cpus = nodes[node];
+
+    thread_function f = { &scheduler_, std::vector<std::size_t>() };
+    if (pin_threads)
+      f.cpus_.push_back(node_cpus[(i - first_in_node) % node_cpus.size()]);
+    else
+      f.cpus_ = node_cpus;
+    threads_.create_thread(f);
+  }
 }
 
 void thread_pool::stop()
@@ -120,7 +158,7 @@ void thread_pool::stop()
 void thread_pool::attach()
 {
   ++num_threads_;
-  thread_function f = { &scheduler_ };
+  thread_function f = { &scheduler_, std::vector<std::size_t>() };
   f();
 }
 
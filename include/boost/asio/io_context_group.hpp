@@ -0,0 +1,218 @@
+//
+// io_context_group.hpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_IO_CONTEXT_GROUP_HPP
+#define BOOST_ASIO_IO_CONTEXT_GROUP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_THREADS) || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/detail/atomic_count.hpp>
+#include <boost/asio/detail/thread_group.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+/// A fixed-size group of io_context objects, each run by its own thread.
+/**
+ * The io_context_group class implements the "one io_context per core"
+ * architecture. The group owns a number of shards, each consisting of an
+ * io_context and a single thread that runs it. I/O objects are associated
+ * with one shard for their lifetime, so their operations and handlers never
+ * contend with those of other shards.
+ *
+ * By default, each shard's io_context is configured with a
+ * <tt>scheduler.concurrency_hint</tt> of @c 1 and with
+ * <tt>scheduler.injection_queue</tt> enabled, so that functions posted to a
+ * shard from the threads of other shards do not acquire the shard's internal
+ * lock.
+ *
+ * Each shard's io_context has its own reactor, such as its own @c epoll set,
+ * which waits only for the shard's own I/O objects. If the I/O objects of a
+ * shard are created and used only by functions running on that shard's thread,
+ * the reactor's internal locking may also be disabled by constructing the
+ * group with a configuration such as:
+ * @code boost::asio::io_context_group group(n, true,
+ *     boost::asio::config_from_string(
+ *       "scheduler.concurrency_hint=1\n"
+ *       "scheduler.injection_queue=1\n"
+ *       "reactor.registration_locking=0\n"
+ *       "reactor.io_locking=0")); @endcode
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Safe, with the exception of the join() and wait()
+ * functions, which must not be called at the same time as other calls to
+ * join() or wait() on the same group.
+ *
+ * @par Example
+ * @code // Launch one shard per CPU, with each shard's thread bound to a CPU.
+ * boost::asio::io_context_group group(
+ *     std::thread::hardware_concurrency(), true);
+ *
+ * // Create a socket on the next shard, in round-robin order.
+ * boost::asio::ip::tcp::socket socket(group.next_io_context());
+ *
+ * // Submit a function to run on shard 0.
+ * boost::asio::post(group.get_executor(0), my_task); @endcode
+ */
+class io_context_group
+{
+public:
+  /// The type of the executor used to submit functions to a shard.
+  typedef io_context::executor_type executor_type;
+
+  /// Constructs a group with a specified number of shards.
+  /**
+   * @param num_shards The number of shards, and threads, in the group.
+   *
+   * @param pin_threads If @c true, the thread that runs shard @c i is bound to
+   * the <tt>i % n</tt>th of the @c n CPUs on which the process is permitted to
+   * run. Binding is not supported on all platforms and, if it fails, the
+   * thread runs unbound.
+   */
+  BOOST_ASIO_DECL explicit io_context_group(
+      std::size_t num_shards, bool pin_threads = false);
+
+  /// Constructs a group with a specified number of shards.
+  /**
+   * @param num_shards The number of shards, and threads, in the group.
+   *
+   * @param pin_threads If @c true, the thread that runs shard @c i is bound to
+   * the <tt>i % n</tt>th of the @c n CPUs on which the process is permitted to
+   * run.
+   *
+   * @param initial_services Used to create the initial services of each
+   * shard's io_context, in place of the default configuration.
+   */
+  BOOST_ASIO_DECL io_context_group(std::size_t num_shards, bool pin_threads,
+      const execution_context::service_maker& initial_services);
+
+  /// Destructor.
+  /**
+   * Automatically stops and joins the group, if not explicitly done
+   * beforehand.
+   */
+  BOOST_ASIO_DECL ~io_context_group();
+
+  /// Obtain the number of shards in the group.
+  std::size_t size() const noexcept
+  {
+    return io_contexts_.size();
+  }
+
+  /// Obtain the io_context of the specified shard.
+  io_context& get_io_context(std::size_t index) noexcept
+  {
+    return *io_contexts_[index];
+  }
+
+  /// Obtain the executor of the specified shard.
+  /**
+   * The executor may be used to submit functions to the shard from any
+   * thread, including the threads that run other shards.
+   */
+  executor_type get_executor(std::size_t index) noexcept
+  {
+    return io_contexts_[index]->get_executor();
+  }
+
+  /// Obtain the io_context of a shard, choosing the shards in turn.
+  BOOST_ASIO_DECL io_context& next_io_context() noexcept;
+
+  /// Obtain the CPU to which a shard's thread is bound.
+  /**
+   * @returns The CPU number, or @c -1 if the group was constructed without
+   * binding threads to CPUs, or if the shard's thread could not be bound.
+   */
+  int cpu(std::size_t index) const noexcept
+  {
+    return cpus_[index];
+  }
+
+  /// Stops the shards.
+  /**
+   * This function stops all shards' io_context objects as soon as possible.
+   * As a result of calling @c stop(), pending function objects may never
+   * be invoked.
+   */
+  BOOST_ASIO_DECL void stop();
+
+  /// Joins the threads.
+  /**
+   * This function blocks until the threads in the group have completed. If @c
+   * stop() is not called prior to @c join(), the @c join() call will wait
+   * until all shards have no more outstanding work.
+   *
+   * @note Each shard's thread exits as soon as that shard has no outstanding
+   * work. Functions subsequently posted to the shard from other shards are not
+   * run. Use an executor_work_guard, or an executor with the
+   * @c outstanding_work.tracked property, to keep a shard running while other
+   * shards may still submit functions to it.
+   */
+  BOOST_ASIO_DECL void join();
+
+  /// Waits for threads to complete.
+  /**
+   * @note @c wait() is synonymous with @c join().
+   */
+  BOOST_ASIO_DECL void wait();
+
+private:
+  io_context_group(const io_context_group&) = delete;
+  io_context_group& operator=(const io_context_group&) = delete;
+
+  struct thread_function;
+  struct binding_wait;
+
+  // Helper function to create the shards and start their threads.
+  BOOST_ASIO_DECL void start(std::size_t num_shards, bool pin_threads,
+      const execution_context::service_maker& initial_services);
+
+  // The io_context objects, one per shard.
+  std::vector<std::unique_ptr<io_context>> io_contexts_;
+
+  // The CPUs to which the shards' threads are bound, or -1 if not bound.
+  std::vector<int> cpus_;
+
+  // Work guards to keep the shards running until joined.
+  std::vector<executor_work_guard<executor_type>> work_;
+
+  // The threads that run the shards.
+  detail::thread_group<std::allocator<void>> threads_;
+
+  // Used to choose shards in turn.
+  detail::atomic_count next_io_context_;
+};
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#if defined(BOOST_ASIO_HEADER_ONLY)
+# include <boost/asio/impl/io_context_group.ipp>
+#endif // defined(BOOST_ASIO_HEADER_ONLY)
+
+#endif // defined(BOOST_ASIO_HAS_THREADS) || defined(GENERATING_DOCUMENTATION)
+
+#endif // BOOST_ASIO_IO_CONTEXT_GROUP_HPP
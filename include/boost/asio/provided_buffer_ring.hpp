@@ -0,0 +1,330 @@
+//
+// provided_buffer_ring.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_PROVIDED_BUFFER_RING_HPP
+#define BOOST_ASIO_PROVIDED_BUFFER_RING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/execution/context.hpp>
+#include <boost/asio/execution/executor.hpp>
+#include <boost/asio/execution_context.hpp>
+#include <boost/asio/is_executor.hpp>
+#include <boost/asio/query.hpp>
+#include <boost/asio/detail/mutex.hpp>
+#include <boost/asio/detail/throw_error.hpp>
+#include <boost/asio/detail/type_traits.hpp>
+
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+# include <boost/asio/detail/scheduler.hpp>
+# include <boost/asio/detail/io_uring_service.hpp>
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+class provided_buffer_ring_base;
+
+} // namespace detail
+
+/// A buffer that has been selected from a provided_buffer_ring to hold the
+/// data for a receive operation.
+/**
+ * The buffer refers to storage owned by the provided_buffer_ring. Once the
+ * application has finished processing the data, it must return the buffer to
+ * the ring using provided_buffer_ring::recycle() so that it may be selected
+ * by subsequent receive operations.
+ */
+class provided_buffer
+{
+public:
+  /// Default constructor creates an invalid provided buffer.
+  provided_buffer() noexcept
+    : buffer_(),
+      id_(-1)
+  {
+  }
+
+  /// Get the buffer containing the received data.
+  const mutable_buffer& buffer() const noexcept
+  {
+    return buffer_;
+  }
+
+  /// Get a pointer to the beginning of the received data.
+  void* data() const noexcept
+  {
+    return buffer_.data();
+  }
+
+  /// Get the number of bytes of received data.
+  std::size_t size() const noexcept
+  {
+    return buffer_.size();
+  }
+
+  /// Get the buffer's identifier within its ring, or -1 if the buffer is
+  /// invalid.
+  int id() const noexcept
+  {
+    return id_;
+  }
+
+private:
+  friend class detail::provided_buffer_ring_base;
+
+  provided_buffer(const mutable_buffer& b, int i) noexcept
+    : buffer_(b),
+      id_(i)
+  {
+  }
+
+  mutable_buffer buffer_;
+  int id_;
+};
+
+namespace detail {
+
+class provided_buffer_ring_base
+{
+public:
+  // Get the number of buffers in the ring.
+  std::size_t buffer_count() const noexcept
+  {
+    return count_;
+  }
+
+  // Get the size of each buffer in the ring.
+  std::size_t buffer_size() const noexcept
+  {
+    return size_;
+  }
+
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  // Get the buffer group identifier used to select buffers in the kernel.
+  int group_id() const noexcept
+  {
+    return group_id_;
+  }
+#else // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  // Select a free buffer in user space. Returns -1 if none is available.
+  int select_buffer()
+  {
+    mutex::scoped_lock lock(mutex_);
+    if (free_ids_.empty())
+      return -1;
+    int id = free_ids_.back();
+    free_ids_.pop_back();
+    return id;
+  }
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+
+  // Get the whole of the storage for the buffer with the specified id.
+  mutable_buffer buffer_at(int id) const noexcept
+  {
+    return mutable_buffer(data_.get() + id * size_, size_);
+  }
+
+  // Create a provided buffer holding the first n bytes of the specified id.
+  provided_buffer make_buffer(int id, std::size_t n) const noexcept
+  {
+    return provided_buffer(mutable_buffer(
+          data_.get() + id * size_, n < size_ ? n : size_), id);
+  }
+
+  // Return the buffer with the specified id to the ring.
+  void recycle_buffer(int id)
+  {
+    mutex::scoped_lock lock(mutex_);
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+    io_uring_service::recycle_buffer(ring_,
+        static_cast<unsigned>(count_), data_.get() + id * size_, size_, id);
+#else // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+    free_ids_.push_back(id);
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  }
+
+protected:
+  provided_buffer_ring_base(execution_context& ctx,
+      std::size_t buffer_count, std::size_t buffer_size)
+    : count_(buffer_count),
+      size_(buffer_size)
+  {
+    // Buffer identifiers are 16 bits and the ring is indexed by mask, so the
+    // number of buffers must be a power of two that fits in half that range.
+    if (count_ == 0 || count_ > 32768
+        || (count_ & (count_ - 1)) != 0 || size_ == 0)
+    {
+      boost::system::error_code ec(boost::asio::error::invalid_argument);
+      boost::asio::detail::throw_error(ec, "provided_buffer_ring");
+    }
+
+    data_.reset(new char[count_ * size_]);
+
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+    service_ = &use_service<io_uring_service>(ctx);
+    group_id_ = service_->register_buffer_ring(ring_, data_.get(),
+        static_cast<unsigned>(count_), size_);
+#else // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+    (void)ctx;
+    free_ids_.reserve(count_);
+    for (std::size_t i = count_; i > 0; --i)
+      free_ids_.push_back(static_cast<int>(i - 1));
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  }
+
+  ~provided_buffer_ring_base()
+  {
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+    service_->unregister_buffer_ring(ring_,
+        static_cast<unsigned>(count_), group_id_);
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  }
+
+private:
+  // Disallow copying and assignment.
+  provided_buffer_ring_base(const provided_buffer_ring_base&) = delete;
+  provided_buffer_ring_base& operator=(
+      const provided_buffer_ring_base&) = delete;
+
+  mutex mutex_;
+  std::size_t count_;
+  std::size_t size_;
+  std::unique_ptr<char[]> data_;
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  io_uring_service* service_;
+  ::io_uring_buf_ring* ring_;
+  int group_id_;
+#else // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  std::vector<int> free_ids_;
+#endif // defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+};
+
+} // namespace detail
+
+/// A ring of buffers from which receive operations select storage at the time
+/// data arrives.
+/**
+ * A provided buffer ring owns a fixed number of equally sized buffers. Rather
+ * than supplying a buffer when a receive operation is started, the
+ * application passes the ring, and a buffer is selected only once data is
+ * available. This allows a large number of idle connections to wait for data
+ * without each one holding a receive buffer.
+ *
+ * When io_uring is used as the default backend, the ring is registered with
+ * the kernel and buffers are selected without a round trip to user space. On
+ * other reactor-based backends the ring is managed in user space.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Safe.
+ */
+class provided_buffer_ring
+  : public detail::provided_buffer_ring_base
+{
+public:
+  /// Create a ring of buffers for use with an executor's execution context.
+  /**
+   * @param ex The executor whose execution context the ring will be used with.
+   *
+   * @param buffer_count The number of buffers in the ring. Must be a power of
+   * two no greater than 32768.
+   *
+   * @param buffer_size The size of each buffer in the ring.
+   *
+   * @throws boost::system::system_error Thrown on failure.
+   */
+  template <typename Executor>
+  provided_buffer_ring(const Executor& ex,
+      std::size_t buffer_count, std::size_t buffer_size,
+      constraint_t<
+        is_executor<Executor>::value || execution::is_executor<Executor>::value
+      > = 0)
+    : detail::provided_buffer_ring_base(
+        provided_buffer_ring::get_context(ex), buffer_count, buffer_size)
+  {
+  }
+
+  /// Create a ring of buffers for use with an execution context.
+  /**
+   * @param ctx The execution context the ring will be used with.
+   *
+   * @param buffer_count The number of buffers in the ring. Must be a power of
+   * two no greater than 32768.
+   *
+   * @param buffer_size The size of each buffer in the ring.
+   *
+   * @throws boost::system::system_error Thrown on failure.
+   */
+  template <typename ExecutionContext>
+  provided_buffer_ring(ExecutionContext& ctx,
+      std::size_t buffer_count, std::size_t buffer_size,
+      constraint_t<
+        is_convertible<ExecutionContext&, execution_context&>::value
+      > = 0)
+    : detail::provided_buffer_ring_base(ctx, buffer_count, buffer_size)
+  {
+  }
+
+  /// Destroys the ring, unregistering the buffers.
+  /**
+   * The ring must not be destroyed while there are outstanding receive
+   * operations using it.
+   */
+  ~provided_buffer_ring()
+  {
+  }
+
+  /// Return a buffer to the ring so that it may be selected again.
+  /**
+   * @param b A buffer that was delivered by a receive operation using this
+   * ring. Invalid buffers are ignored.
+   */
+  void recycle(const provided_buffer& b)
+  {
+    if (b.id() >= 0)
+      this->recycle_buffer(b.id());
+  }
+
+private:
+  // Helper function to get an executor's context.
+  template <typename T>
+  static execution_context& get_context(const T& t,
+      enable_if_t<execution::is_executor<T>::value>* = 0)
+  {
+    return boost::asio::query(t, execution::context);
+  }
+
+  // Helper function to get an executor's context.
+  template <typename T>
+  static execution_context& get_context(const T& t,
+      enable_if_t<!execution::is_executor<T>::value>* = 0)
+  {
+    return t.context();
+  }
+};
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_PROVIDED_BUFFER_RING_HPP
@@ -0,0 +1,288 @@
+//
+// sharded_acceptor.hpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_SHARDED_ACCEPTOR_HPP
+#define BOOST_ASIO_SHARDED_ACCEPTOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_THREADS) || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include <vector>
+#include <boost/asio/basic_socket_acceptor.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context_group.hpp>
+#include <boost/asio/socket_base.hpp>
+#include <boost/asio/detail/socket_option.hpp>
+#include <boost/asio/detail/socket_types.hpp>
+#include <boost/asio/detail/throw_error.hpp>
+
+#if defined(__linux__)
+# include <linux/filter.h>
+#endif // defined(__linux__)
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+# define BOOST_ASIO_HAS_REUSEPORT_CBPF 1
+
+// Socket option to attach a classic BPF program that chooses a socket in an
+// SO_REUSEPORT group using the number of the CPU that received the packet.
+class reuseport_cpu_program
+{
+public:
+  explicit reuseport_cpu_program(std::size_t num_sockets)
+  {
+    sock_filter code[] =
+    {
+      // A = the number of the current CPU.
+      { BPF_LD | BPF_W | BPF_ABS, 0, 0,
+        static_cast<__u32>(SKF_AD_OFF + SKF_AD_CPU) },
+      // A = A % num_sockets.
+      { BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<__u32>(num_sockets) },
+      // Return A as the index of the socket in the group.
+      { BPF_RET | BPF_A, 0, 0, 0 }
+    };
+    for (std::size_t i = 0; i < sizeof(code) / sizeof(code[0]); ++i)
+      code_[i] = code[i];
+    program_.len = sizeof(code_) / sizeof(code_[0]);
+    program_.filter = code_;
+  }
+
+  template <typename Protocol>
+  int level(const Protocol&) const
+  {
+    return SOL_SOCKET;
+  }
+
+  template <typename Protocol>
+  int name(const Protocol&) const
+  {
+    return SO_ATTACH_REUSEPORT_CBPF;
+  }
+
+  template <typename Protocol>
+  const sock_fprog* data(const Protocol&) const
+  {
+    return &program_;
+  }
+
+  template <typename Protocol>
+  std::size_t size(const Protocol&) const
+  {
+    return sizeof(program_);
+  }
+
+private:
+  reuseport_cpu_program(const reuseport_cpu_program&) = delete;
+  reuseport_cpu_program& operator=(const reuseport_cpu_program&) = delete;
+
+  sock_filter code_[3];
+  sock_fprog program_;
+};
+
+#endif // defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+
+} // namespace detail
+
+/// Listens for connections on a single endpoint from every shard of an
+/// io_context_group.
+/**
+ * The sharded_acceptor class template opens one listening socket per shard of
+ * an io_context_group, all bound to the same endpoint using the
+ * @c SO_REUSEPORT socket option. The operating system distributes incoming
+ * connections between the listening sockets, and a connection accepted by a
+ * shard's acceptor is associated with that shard's io_context, so that it is
+ * never handled by another shard's thread.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe. Each acceptor may be used from its own
+ * shard's thread.
+ *
+ * @par Example
+ * @code boost::asio::io_context_group group(4, true);
+ * boost::asio::sharded_acceptor<boost::asio::ip::tcp> acceptor(group,
+ *     boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), 8080),
+ *     boost::asio::sharded_acceptor<boost::asio::ip::tcp>::steer_cpu_program);
+ *
+ * for (std::size_t i = 0; i < acceptor.size(); ++i)
+ *   start_accept(acceptor.get_acceptor(i)); @endcode
+ */
+template <typename Protocol>
+class sharded_acceptor
+{
+public:
+  /// The protocol type.
+  typedef Protocol protocol_type;
+
+  /// The endpoint type.
+  typedef typename Protocol::endpoint endpoint_type;
+
+  /// The type of the acceptor used by each shard.
+  typedef basic_socket_acceptor<Protocol,
+    io_context_group::executor_type> acceptor_type;
+
+  /// Different ways of steering new connections to the shards.
+  enum steering_type
+  {
+    /// Let the operating system distribute connections using a hash of the
+    /// connection's addresses and ports.
+    steer_none,
+
+    /// Set each listening socket's @c SO_INCOMING_CPU option to the CPU of its
+    /// shard, so that the operating system prefers the listening socket of
+    /// the shard that runs on the CPU receiving the connection. Has no effect
+    /// for shards whose threads are not bound to CPUs.
+    steer_incoming_cpu,
+
+    /// Attach a program to the listening sockets that chooses the acceptor of
+    /// shard <tt>c % n</tt>, where @c c is the CPU receiving the connection
+    /// and @c n is the number of shards. When the group's threads are bound to
+    /// CPUs and there is one shard per CPU, each connection is handled on the
+    /// CPU that received it.
+    steer_cpu_program
+  };
+
+  /// Construct an acceptor for each shard, listening on the given endpoint.
+  /**
+   * @param group The group whose shards will accept connections.
+   *
+   * @param endpoint The endpoint on which to listen. If the port is zero, the
+   * first acceptor is bound to an ephemeral port and the other acceptors are
+   * bound to the same port.
+   *
+   * @param steering How new connections are distributed between the shards.
+   *
+   * @param backlog The maximum length of each acceptor's queue of pending
+   * connections.
+   *
+   * @throws boost::system::system_error Thrown on failure. The
+   * @c operation_not_supported error is reported if the platform does not
+   * support @c SO_REUSEPORT, or the requested steering.
+   */
+  sharded_acceptor(io_context_group& group, const endpoint_type& endpoint,
+      steering_type steering = steer_none,
+      int backlog = socket_base::max_listen_connections)
+  {
+    acceptors_.reserve(group.size());
+    endpoint_type bind_endpoint(endpoint);
+    for (std::size_t i = 0; i < group.size(); ++i)
+    {
+      acceptors_.emplace_back(group.get_executor(i));
+      acceptor_type& acceptor = acceptors_.back();
+      acceptor.open(bind_endpoint.protocol());
+      acceptor.set_option(socket_base::reuse_address(true));
+      set_reuse_port(acceptor);
+      if (steering == steer_incoming_cpu && group.cpu(i) >= 0)
+        set_incoming_cpu(acceptor, group.cpu(i));
+      acceptor.bind(bind_endpoint);
+      acceptor.listen(backlog);
+      if (i == 0)
+        bind_endpoint = acceptor.local_endpoint();
+    }
+
+    if (steering == steer_cpu_program && !acceptors_.empty())
+      attach_cpu_program(acceptors_.front(), acceptors_.size());
+  }
+
+  /// Obtain the number of acceptors, which is equal to the number of shards.
+  std::size_t size() const noexcept
+  {
+    return acceptors_.size();
+  }
+
+  /// Obtain the acceptor of the specified shard.
+  acceptor_type& get_acceptor(std::size_t index) noexcept
+  {
+    return acceptors_[index];
+  }
+
+  /// Obtain the endpoint on which the acceptors are listening.
+  endpoint_type local_endpoint() const
+  {
+    return acceptors_.front().local_endpoint();
+  }
+
+  /// Close all acceptors.
+  /**
+   * This function must not be called while asynchronous operations are being
+   * started or completed by the shards. To close the acceptors while the
+   * shards are running, close each acceptor from its own shard's thread.
+   */
+  void close()
+  {
+    for (std::size_t i = 0; i < acceptors_.size(); ++i)
+      acceptors_[i].close();
+  }
+
+private:
+  sharded_acceptor(const sharded_acceptor&) = delete;
+  sharded_acceptor& operator=(const sharded_acceptor&) = delete;
+
+  static void set_reuse_port(acceptor_type& acceptor)
+  {
+#if defined(SO_REUSEPORT)
+    acceptor.set_option(detail::socket_option::boolean<
+        BOOST_ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+#else // defined(SO_REUSEPORT)
+    (void)acceptor;
+    boost::asio::detail::throw_error(
+        boost::asio::error::operation_not_supported, "set_option");
+#endif // defined(SO_REUSEPORT)
+  }
+
+  static void set_incoming_cpu(acceptor_type& acceptor, int cpu)
+  {
+#if defined(SO_INCOMING_CPU)
+    acceptor.set_option(detail::socket_option::integer<
+        BOOST_ASIO_OS_DEF(SOL_SOCKET), SO_INCOMING_CPU>(cpu));
+#else // defined(SO_INCOMING_CPU)
+    (void)acceptor;
+    (void)cpu;
+    boost::asio::detail::throw_error(
+        boost::asio::error::operation_not_supported, "set_option");
+#endif // defined(SO_INCOMING_CPU)
+  }
+
+  static void attach_cpu_program(acceptor_type& acceptor,
+      std::size_t num_sockets)
+  {
+#if defined(BOOST_ASIO_HAS_REUSEPORT_CBPF)
+    acceptor.set_option(detail::reuseport_cpu_program(num_sockets));
+#else // defined(BOOST_ASIO_HAS_REUSEPORT_CBPF)
+    (void)acceptor;
+    (void)num_sockets;
+    boost::asio::detail::throw_error(
+        boost::asio::error::operation_not_supported, "set_option");
+#endif // defined(BOOST_ASIO_HAS_REUSEPORT_CBPF)
+  }
+
+  // The acceptors, one per shard.
+  std::vector<acceptor_type> acceptors_;
+};
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_THREADS) || defined(GENERATING_DOCUMENTATION)
+
+#endif // BOOST_ASIO_SHARDED_ACCEPTOR_HPP
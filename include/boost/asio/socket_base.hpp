@@ -504,6 +504,193 @@ public:
     enable_connection_aborted;
 #endif
 
+  /// Socket option to satisfy accept operations from a multishot accept.
+  /**
+   * Implements a custom socket option that determines whether or not an
+   * acceptor's asynchronous accept operations are satisfied from a single,
+   * persistent multishot accept. By default the option is false.
+   *
+   * When enabled on the io_uring backend, the first asynchronous accept arms
+   * one multishot accept operation which then remains active until the
+   * acceptor is cancelled or closed. Each newly accepted connection is used to
+   * complete the next queued @c async_accept, or is retained by the acceptor
+   * until the next @c async_accept is started. Connections that are still
+   * retained when the acceptor is closed are discarded. On other backends the
+   * option is stored but otherwise has no effect.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * boost::asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * boost::asio::socket_base::multishot_accept option(true);
+   * acceptor.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * boost::asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * boost::asio::socket_base::multishot_accept option;
+   * acceptor.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined multishot_accept;
+#else
+  typedef boost::asio::detail::socket_option::boolean<
+    boost::asio::detail::custom_socket_option_level,
+    boost::asio::detail::multishot_accept_option>
+    multishot_accept;
+#endif
+
+  /// Socket option to satisfy receive operations from a multishot receive.
+  /**
+   * Implements a custom socket option that determines whether or not a
+   * socket's asynchronous receive operations that select their storage from a
+   * provided_buffer_ring are satisfied from a single, persistent multishot
+   * receive. By default the option is false.
+   *
+   * When enabled on the io_uring backend, the first such receive arms one
+   * multishot receive operation which then remains active until the socket is
+   * cancelled or closed, or until the ring runs out of buffers. Each datagram
+   * or chunk of stream data is used to complete the next queued receive, or is
+   * retained by the socket until the next receive is started. Retained data
+   * is returned to the ring when the socket is closed. All receives on the
+   * socket must use the same ring while the option is enabled. On other
+   * backends the option is stored but otherwise has no effect.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * boost::asio::ip::udp::socket socket(my_context);
+   * ...
+   * boost::asio::socket_base::multishot_receive option(true);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * boost::asio::ip::udp::socket socket(my_context);
+   * ...
+   * boost::asio::socket_base::multishot_receive option;
+   * socket.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined multishot_receive;
+#else
+  typedef boost::asio::detail::socket_option::boolean<
+    boost::asio::detail::custom_socket_option_level,
+    boost::asio::detail::multishot_receive_option>
+    multishot_receive;
+#endif
+
+  /// Socket option to send data without copying it.
+  /**
+   * Implements a custom socket option that determines whether or not a
+   * socket's asynchronous send operations avoid copying the data into the
+   * kernel. By default the option is false.
+   *
+   * When enabled, the io_uring backend sends data using
+   * @c IORING_OP_SEND_ZC, and the epoll backend sends data using
+   * @c MSG_ZEROCOPY. Each send operation completes only once the kernel has
+   * released the buffers, which occurs after the data has been acknowledged by
+   * the peer. Zero-copy sends are generally only beneficial for large
+   * buffers. On other backends the option is stored but otherwise has no
+   * effect.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * boost::asio::ip::tcp::socket socket(my_context);
+   * ...
+   * boost::asio::socket_base::zero_copy_send option(true);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * boost::asio::ip::tcp::socket socket(my_context);
+   * ...
+   * boost::asio::socket_base::zero_copy_send option;
+   * socket.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined zero_copy_send;
+#else
+  typedef boost::asio::detail::socket_option::boolean<
+    boost::asio::detail::custom_socket_option_level,
+    boost::asio::detail::zero_copy_send_option>
+    zero_copy_send;
+#endif
+
+  /// Socket option to complete immediately finished operations inline.
+  /**
+   * Implements a custom socket option that determines whether or not a
+   * socket's asynchronous operations that finish immediately may invoke their
+   * completion handlers before the initiating function returns. By default the
+   * option is false.
+   *
+   * When enabled on a reactor-based backend whose @c reactor configuration
+   * option @c inline_completion_depth is non-zero, a read or write operation
+   * that is started by a thread running the @c io_context, and that completes
+   * without waiting, invokes its completion handler inline, up to the
+   * configured depth of nested completions. Handlers that have an associated
+   * immediate executor are unaffected. On other backends the option is stored
+   * but otherwise has no effect.
+   *
+   * Enabling this option removes the guarantee that a completion handler is
+   * never invoked from within the initiating function, so it should only be
+   * used with handlers that are written to allow this.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * boost::asio::ip::tcp::socket socket(my_context);
+   * ...
+   * boost::asio::socket_base::inline_completion option(true);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * boost::asio::ip::tcp::socket socket(my_context);
+   * ...
+   * boost::asio::socket_base::inline_completion option;
+   * socket.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined inline_completion;
+#else
+  typedef boost::asio::detail::socket_option::boolean<
+    boost::asio::detail::custom_socket_option_level,
+    boost::asio::detail::inline_completion_option>
+    inline_completion;
+#endif
+
   /// IO control command to get the amount of data that can be read without
   /// blocking.
   /**
@@ -345,6 +345,20 @@ public:
     return detail::strand_executor_service::running_in_this_thread(impl_);
   }
 
+  /// Obtain statistics about the function objects run by the strand.
+  /**
+   * This function may be called from any thread. Each value is read
+   * individually, so when the strand is running function objects on another
+   * thread the values may not all reflect the same point in time. To obtain
+   * consistent values, call this function from within a function object
+   * running on the strand, or when no other thread is running the strand's
+   * function objects.
+   */
+  strand_statistics statistics() const
+  {
+    return detail::strand_executor_service::statistics(impl_);
+  }
+
   /// Compare two strands for equality.
   /**
    * Two strands are equal if they refer to the same ordered, non-concurrent
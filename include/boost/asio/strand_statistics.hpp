@@ -0,0 +1,58 @@
+//
+// strand_statistics.hpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_STRAND_STATISTICS_HPP
+#define BOOST_ASIO_STRAND_STATISTICS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+/// Statistics about the function objects run by a strand.
+/**
+ * A strand runs the function objects submitted to it in turns. A turn begins
+ * when the strand is scheduled on its underlying executor, and runs the
+ * function objects that were waiting at that time, subject to the @c strand
+ * configuration options @c handler_budget and @c time_slice_usec.
+ */
+struct strand_statistics
+{
+  /// The number of turns the strand has taken.
+  std::size_t turns;
+
+  /// The number of function objects run by the strand's turns.
+  std::size_t handlers;
+
+  /// The largest number of function objects run in a single turn.
+  std::size_t max_handlers_per_turn;
+
+  /// The largest number of function objects waiting to run at the start of a
+  /// turn.
+  std::size_t max_queue_depth;
+
+  /// The number of turns that ended, because the handler budget or time slice
+  /// was exhausted, while function objects were still waiting to run.
+  std::size_t yields;
+};
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_STRAND_STATISTICS_HPP
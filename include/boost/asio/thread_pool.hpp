@@ -82,6 +82,21 @@ namespace detail {
  *
  * // Wait for all tasks in the pool to complete.
  * pool.join(); @endcode
+ *
+ * @par Thread placement
+ *
+ * By default, the operating system decides where the pool's threads run. The
+ * <tt>thread_pool.pin_threads</tt> and <tt>thread_pool.numa_nodes</tt>
+ * configuration options bind the threads to the CPUs on which the process is
+ * permitted to run. On machines with more than one NUMA node, keeping each
+ * thread on one node, and enabling <tt>scheduler.handler_arena</tt> so that
+ * each thread allocates handlers from memory it first touched, keeps handler
+ * memory local to the node that uses it:
+ *
+ * @code boost::asio::thread_pool pool(32,
+ *     boost::asio::config_from_string(
+ *       "thread_pool.numa_nodes=1\n"
+ *       "scheduler.handler_arena=1")); @endcode
  */
 class thread_pool
   : public execution_context
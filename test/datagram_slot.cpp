@@ -0,0 +1,73 @@
+//
+// datagram_slot.cpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include <boost/asio/datagram_slot.hpp>
+
+#include <boost/asio/ip/udp.hpp>
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// datagram_slot_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the datagram_slot class.
+
+namespace datagram_slot_runtime {
+
+void test()
+{
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  char data[16];
+  const ip::udp::endpoint endpoint(ip::address_v4::loopback(), 12345);
+
+  datagram_slot<const_buffer, ip::udp::endpoint> slot1;
+  BOOST_ASIO_CHECK(slot1.buffer().size() == 0);
+  BOOST_ASIO_CHECK(slot1.endpoint() == ip::udp::endpoint());
+  BOOST_ASIO_CHECK(slot1.bytes_transferred() == 0);
+
+  slot1.buffer(buffer(data));
+  slot1.endpoint(endpoint);
+  slot1.bytes_transferred(10);
+  BOOST_ASIO_CHECK(slot1.buffer().data() == data);
+  BOOST_ASIO_CHECK(slot1.buffer().size() == sizeof(data));
+  BOOST_ASIO_CHECK(slot1.endpoint() == endpoint);
+  BOOST_ASIO_CHECK(slot1.bytes_transferred() == 10);
+
+  datagram_slot<const_buffer, ip::udp::endpoint> slot2(
+      buffer(data), endpoint);
+  BOOST_ASIO_CHECK(slot2.buffer().data() == data);
+  BOOST_ASIO_CHECK(slot2.endpoint() == endpoint);
+  BOOST_ASIO_CHECK(slot2.bytes_transferred() == 0);
+
+  datagram_slot<mutable_buffer, ip::udp::endpoint> slot3(buffer(data));
+  BOOST_ASIO_CHECK(slot3.buffer().data() == data);
+  BOOST_ASIO_CHECK(slot3.endpoint() == ip::udp::endpoint());
+
+  slot3.endpoint().port(54321);
+  BOOST_ASIO_CHECK(slot3.endpoint().port() == 54321);
+}
+
+} // namespace datagram_slot_runtime
+
+//------------------------------------------------------------------------------
+
+BOOST_ASIO_TEST_SUITE
+(
+  "datagram_slot",
+  BOOST_ASIO_TEST_CASE(datagram_slot_runtime::test)
+)
@@ -20,6 +20,7 @@
 #include <sstream>
 #include <boost/asio/bind_executor.hpp>
 #include <boost/asio/dispatch.hpp>
+#include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/detail/thread.hpp>
@@ -264,6 +265,109 @@ void io_context_test()
   BOOST_ASIO_CHECK(exception_count == 2);
 }
 
+void check_sequence(int* next, int value, int* count)
+{
+  BOOST_ASIO_CHECK(*next == value);
+  *next = value + 1;
+  ++(*count);
+}
+
+void post_sequence(io_context* ioc, int* next, int* count)
+{
+  for (int i = 0; i < 10000; ++i)
+  {
+    if (i % 2 == 0)
+      boost::asio::post(*ioc, bindns::bind(check_sequence, next, i, count));
+    else
+      boost::asio::dispatch(*ioc, bindns::bind(check_sequence, next, i, count));
+  }
+}
+
+void io_context_injection_queue_test()
+{
+  io_context ioc(boost::asio::config_from_string(
+        "scheduler.concurrency_hint=1\n"
+        "scheduler.injection_queue=true"));
+  int next[4] = { 0, 0, 0, 0 };
+  int count = 0;
+
+  executor_work_guard<io_context::executor_type> work =
+    boost::asio::make_work_guard(ioc);
+  boost::asio::detail::thread runner(bindns::bind(io_context_run, &ioc));
+
+  // Handlers posted by each thread must run in the order they were posted.
+  boost::asio::detail::thread producer1(
+      bindns::bind(post_sequence, &ioc, &next[0], &count));
+  boost::asio::detail::thread producer2(
+      bindns::bind(post_sequence, &ioc, &next[1], &count));
+  boost::asio::detail::thread producer3(
+      bindns::bind(post_sequence, &ioc, &next[2], &count));
+  boost::asio::detail::thread producer4(
+      bindns::bind(post_sequence, &ioc, &next[3], &count));
+
+  producer1.join();
+  producer2.join();
+  producer3.join();
+  producer4.join();
+  work.reset();
+  runner.join();
+
+  BOOST_ASIO_CHECK(ioc.stopped());
+  BOOST_ASIO_CHECK(count == 40000);
+  BOOST_ASIO_CHECK(next[0] == 10000);
+  BOOST_ASIO_CHECK(next[1] == 10000);
+  BOOST_ASIO_CHECK(next[2] == 10000);
+  BOOST_ASIO_CHECK(next[3] == 10000);
+
+  // Handlers posted while the io_context is not running are run by poll().
+  ioc.restart();
+  count = 0;
+  boost::asio::post(ioc, bindns::bind(increment, &count));
+  boost::asio::post(ioc, bindns::bind(increment, &count));
+  BOOST_ASIO_CHECK(ioc.poll() == 2);
+  BOOST_ASIO_CHECK(count == 2);
+
+  // Handlers that are not run are destroyed with the io_context.
+  boost::asio::post(ioc, bindns::bind(increment, &count));
+}
+
+void io_context_busy_poll_test()
+{
+  io_context ioc(boost::asio::config_from_string(
+        "scheduler.busy_poll_usec=1000"));
+  int count = 0;
+
+  // Handlers posted from other threads are run while the task is polled.
+  executor_work_guard<io_context::executor_type> work =
+    boost::asio::make_work_guard(ioc);
+  boost::asio::detail::thread runner(bindns::bind(io_context_run, &ioc));
+  io_context ioc2;
+  for (int i = 0; i < 100; ++i)
+  {
+    // Vary the interval so that handlers are posted both while the task is
+    // being polled and while it is blocked.
+    timer t(ioc2, chronons::microseconds((i % 5) * 500));
+    t.wait();
+    boost::asio::post(ioc, bindns::bind(increment, &count));
+  }
+  work.reset();
+  runner.join();
+
+  BOOST_ASIO_CHECK(count == 100);
+
+  // Timers expire once the busy-poll budget has been exhausted.
+  ioc.restart();
+  count = 0;
+  timer t(ioc, chronons::milliseconds(50));
+  t.async_wait(bindns::bind(increment, &count));
+  chronons::steady_clock::time_point start = chronons::steady_clock::now();
+  ioc.run();
+
+  BOOST_ASIO_CHECK(count == 1);
+  BOOST_ASIO_CHECK(chronons::steady_clock::now() - start
+      >= chronons::milliseconds(50));
+}
+
 class test_service : public boost::asio::io_context::service
 {
 public:
@@ -705,6 +809,8 @@ BOOST_ASIO_TEST_SUITE
 (
   "io_context",
   BOOST_ASIO_TEST_CASE(io_context_test)
+  BOOST_ASIO_TEST_CASE(io_context_injection_queue_test)
+  BOOST_ASIO_TEST_CASE(io_context_busy_poll_test)
   BOOST_ASIO_TEST_CASE(io_context_service_test)
   BOOST_ASIO_TEST_CASE(io_context_executor_query_test)
   BOOST_ASIO_TEST_CASE(io_context_executor_execute_test)
@@ -0,0 +1,216 @@
+//
+// io_context_group.cpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include <boost/asio/io_context_group.hpp>
+
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <boost/asio/config.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/local/connect_pair.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include "unit_test.hpp"
+
+using namespace boost::asio;
+namespace bindns = std;
+
+void check_shard(io_context_group* group, std::size_t index,
+    std::atomic<int>* count)
+{
+  BOOST_ASIO_CHECK(group->get_executor(index).running_in_this_thread());
+  for (std::size_t i = 0; i < group->size(); ++i)
+    if (i != index)
+      BOOST_ASIO_CHECK(!group->get_executor(i).running_in_this_thread());
+  ++(*count);
+}
+
+typedef std::vector<executor_work_guard<io_context_group::executor_type>>
+  work_guards;
+
+void post_to_next_shard(io_context_group* group, std::size_t index,
+    int hops, std::atomic<int>* count, work_guards* work)
+{
+  BOOST_ASIO_CHECK(group->get_executor(index).running_in_this_thread());
+  ++(*count);
+  if (hops > 0)
+  {
+    std::size_t next = (index + 1) % group->size();
+    boost::asio::post(group->get_executor(next),
+        bindns::bind(post_to_next_shard, group, next, hops - 1, count, work));
+  }
+  else
+  {
+    for (std::size_t i = 0; i < work->size(); ++i)
+      (*work)[i].reset();
+  }
+}
+
+void io_context_group_test()
+{
+  std::atomic<int> count(0);
+
+  io_context_group group(4);
+  BOOST_ASIO_CHECK(group.size() == 4);
+  for (std::size_t i = 0; i < group.size(); ++i)
+    BOOST_ASIO_CHECK(group.cpu(i) == -1);
+
+  // Functions posted to a shard run on that shard's thread.
+  for (std::size_t i = 0; i < group.size(); ++i)
+  {
+    boost::asio::post(group.get_executor(i),
+        bindns::bind(check_shard, &group, i, &count));
+  }
+
+  // Shards are chosen in turn.
+  for (std::size_t i = 0; i < group.size() * 2; ++i)
+    BOOST_ASIO_CHECK(&group.next_io_context()
+        == &group.get_io_context(i % group.size()));
+
+  // Functions may be posted from one shard to another. Each shard runs out of
+  // work independently, so all shards are kept running until the last one.
+  work_guards work;
+  for (std::size_t i = 0; i < group.size(); ++i)
+    work.push_back(boost::asio::make_work_guard(group.get_executor(i)));
+  boost::asio::post(group.get_executor(0),
+      bindns::bind(post_to_next_shard, &group, 0, 1000, &count, &work));
+
+  group.join();
+
+  BOOST_ASIO_CHECK(count == 4 + 1001);
+  for (std::size_t i = 0; i < group.size(); ++i)
+    BOOST_ASIO_CHECK(group.get_io_context(i).stopped());
+}
+
+void io_context_group_pinned_test()
+{
+  std::atomic<int> count(0);
+
+  io_context_group group(2, true);
+  BOOST_ASIO_CHECK(group.size() == 2);
+  for (std::size_t i = 0; i < group.size(); ++i)
+  {
+    BOOST_ASIO_CHECK(group.cpu(i) >= 0);
+    boost::asio::post(group.get_executor(i),
+        bindns::bind(check_shard, &group, i, &count));
+  }
+
+  group.join();
+
+  BOOST_ASIO_CHECK(count == 2);
+}
+
+void io_context_group_stop_test()
+{
+  io_context_group group(2);
+  group.stop();
+  group.join();
+
+  for (std::size_t i = 0; i < group.size(); ++i)
+    BOOST_ASIO_CHECK(group.get_io_context(i).stopped());
+}
+
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+
+struct shard_echo
+{
+  shard_echo(io_context& ioc)
+    : socket1(ioc),
+      socket2(ioc)
+  {
+    local::connect_pair(socket1, socket2);
+  }
+
+  local::stream_protocol::socket socket1;
+  local::stream_protocol::socket socket2;
+  char write_data[64];
+  char read_data[64];
+};
+
+void shard_echo_read(shard_echo* echo, io_context_group* group,
+    std::size_t index, std::atomic<int>* count,
+    const boost::system::error_code& err, std::size_t bytes_transferred)
+{
+  BOOST_ASIO_CHECK(group->get_executor(index).running_in_this_thread());
+  BOOST_ASIO_CHECK(!err);
+  BOOST_ASIO_CHECK(bytes_transferred == sizeof(echo->read_data));
+  ++(*count);
+  delete echo;
+}
+
+void shard_echo_write(io_context_group*, std::size_t,
+    const boost::system::error_code& err, std::size_t)
+{
+  BOOST_ASIO_CHECK(!err);
+}
+
+void start_shard_echo(io_context_group* group, std::size_t index,
+    std::atomic<int>* count)
+{
+  // The I/O objects are created and used only on the shard's own thread.
+  shard_echo* echo = new shard_echo(group->get_io_context(index));
+  for (std::size_t i = 0; i < sizeof(echo->write_data); ++i)
+    echo->write_data[i] = static_cast<char>(i);
+  boost::asio::async_read(echo->socket2, boost::asio::buffer(echo->read_data),
+      bindns::bind(shard_echo_read, echo, group, index, count,
+        bindns::placeholders::_1, bindns::placeholders::_2));
+  boost::asio::async_write(echo->socket1,
+      boost::asio::buffer(echo->write_data),
+      bindns::bind(shard_echo_write, group, index,
+        bindns::placeholders::_1, bindns::placeholders::_2));
+}
+
+#endif // defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+
+void io_context_group_thread_owned_test()
+{
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+  std::atomic<int> count(0);
+
+  // Each shard's reactor and I/O objects are used only by its own thread, so
+  // the reactor's locking may be disabled.
+  io_context_group group(4, false, config_from_string(
+        "scheduler.concurrency_hint=1\n"
+        "scheduler.injection_queue=1\n"
+        "reactor.registration_locking=0\n"
+        "reactor.io_locking=0"));
+
+  for (int n = 0; n < 10; ++n)
+  {
+    for (std::size_t i = 0; i < group.size(); ++i)
+    {
+      boost::asio::post(group.get_executor(i),
+          bindns::bind(start_shard_echo, &group, i, &count));
+    }
+  }
+
+  group.join();
+
+  BOOST_ASIO_CHECK(count == 40);
+#endif // defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+}
+
+BOOST_ASIO_TEST_SUITE
+(
+  "io_context_group",
+  BOOST_ASIO_TEST_CASE(io_context_group_test)
+  BOOST_ASIO_TEST_CASE(io_context_group_pinned_test)
+  BOOST_ASIO_TEST_CASE(io_context_group_stop_test)
+  BOOST_ASIO_TEST_CASE(io_context_group_thread_owned_test)
+)
@@ -21,6 +21,8 @@
 
 #include <cstring>
 #include <functional>
+#include <vector>
+#include <boost/asio/config.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/read.hpp>
 #include <boost/asio/write.hpp>
@@ -171,6 +173,16 @@ private:
   receive_handler(const receive_handler&);
 };
 
+struct send_then_receive_handler
+{
+  send_then_receive_handler() {}
+  void operator()(const boost::system::error_code&,
+      std::size_t, std::size_t) {}
+  send_then_receive_handler(send_then_receive_handler&&) {}
+private:
+  send_then_receive_handler(const send_then_receive_handler&);
+};
+
 struct write_some_handler
 {
   write_some_handler() {}
@@ -475,6 +487,15 @@ void test()
     int i19 = socket1.async_receive(null_buffers(), in_flags, lazy);
     (void)i19;
 
+    socket1.async_send_then_receive(buffer(const_char_buffer),
+        buffer(mutable_char_buffer), send_then_receive_handler());
+    socket1.async_send_then_receive(const_buffers, mutable_buffers,
+        send_then_receive_handler());
+    socket1.async_send_then_receive(buffer(const_char_buffer),
+        buffer(mutable_char_buffer), in_flags, send_then_receive_handler());
+    socket1.async_send_then_receive(const_buffers, mutable_buffers,
+        in_flags, send_then_receive_handler());
+
     socket1.write_some(buffer(mutable_char_buffer));
     socket1.write_some(buffer(const_char_buffer));
     socket1.write_some(mutable_buffers);
@@ -593,6 +614,42 @@ void handle_read_eof(const boost::system::error_code& err,
   BOOST_ASIO_CHECK(bytes_transferred == 0);
 }
 
+void handle_send_then_receive(const boost::system::error_code& err,
+    size_t bytes_sent, size_t bytes_received, bool* called)
+{
+  *called = true;
+  BOOST_ASIO_CHECK(!err);
+  BOOST_ASIO_CHECK(bytes_sent == sizeof(write_data));
+  BOOST_ASIO_CHECK(bytes_received == sizeof(write_data));
+}
+
+void handle_read_all(const boost::system::error_code& err,
+    size_t bytes_transferred, size_t expected_bytes_transferred, bool* called)
+{
+  *called = true;
+  BOOST_ASIO_CHECK(!err);
+  BOOST_ASIO_CHECK(bytes_transferred == expected_bytes_transferred);
+}
+
+void handle_send_then_receive_all(const boost::system::error_code& err,
+    size_t bytes_sent, size_t bytes_received, size_t expected_bytes_sent,
+    bool* called)
+{
+  *called = true;
+  BOOST_ASIO_CHECK(!err);
+  BOOST_ASIO_CHECK(bytes_sent == expected_bytes_sent);
+  BOOST_ASIO_CHECK(bytes_received == sizeof(write_data));
+}
+
+void handle_send_then_receive_eof(const boost::system::error_code& err,
+    size_t bytes_sent, size_t bytes_received, bool* called)
+{
+  *called = true;
+  BOOST_ASIO_CHECK(err == boost::asio::error::eof);
+  BOOST_ASIO_CHECK(bytes_sent == sizeof(write_data));
+  BOOST_ASIO_CHECK(bytes_received == 0);
+}
+
 void test()
 {
   using namespace std; // For memcmp.
@@ -659,6 +716,60 @@ void test()
   BOOST_ASIO_CHECK(write_completed);
   BOOST_ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
 
+  // Read and write to transfer data with zero-copy sends enabled.
+
+  server_side_socket.set_option(socket_base::zero_copy_send(true));
+
+  memset(read_buffer, 0, sizeof(read_buffer));
+  read_completed = false;
+  boost::asio::async_read(client_side_socket,
+      boost::asio::buffer(read_buffer),
+      bindns::bind(handle_read,
+        _1, _2, &read_completed));
+
+  write_completed = false;
+  boost::asio::async_write(server_side_socket,
+      boost::asio::buffer(write_data),
+      bindns::bind(handle_write,
+        _1, _2, &write_completed));
+
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(read_completed);
+  BOOST_ASIO_CHECK(write_completed);
+  BOOST_ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+
+  // The socket may be moved while a zero-copy send is in progress, and sends
+  // on the moved-to socket continue to be matched to their notifications.
+
+  for (int i = 0; i < 2; ++i)
+  {
+    memset(read_buffer, 0, sizeof(read_buffer));
+    read_completed = false;
+    boost::asio::async_read(client_side_socket,
+        boost::asio::buffer(read_buffer),
+        bindns::bind(handle_read,
+          _1, _2, &read_completed));
+
+    write_completed = false;
+    boost::asio::async_write(server_side_socket,
+        boost::asio::buffer(write_data),
+        bindns::bind(handle_write,
+          _1, _2, &write_completed));
+
+    ip::tcp::socket moved_socket(std::move(server_side_socket));
+    server_side_socket = std::move(moved_socket);
+
+    ioc.restart();
+    ioc.run();
+    BOOST_ASIO_CHECK(read_completed);
+    BOOST_ASIO_CHECK(write_completed);
+    BOOST_ASIO_CHECK(
+        memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+  }
+
+  server_side_socket.set_option(socket_base::zero_copy_send(false));
+
   // Cancelled read.
 
   bool read_cancel_completed = false;
@@ -692,6 +803,280 @@ void test()
   BOOST_ASIO_CHECK(read_eof_completed);
 }
 
+void test_transfer_and_close(boost::asio::io_context& ioc, int iterations)
+{
+  using namespace std; // For memcmp and memset.
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  for (int i = 0; i < iterations; ++i)
+  {
+    ip::tcp::socket client_side_socket(ioc);
+    ip::tcp::socket server_side_socket(ioc);
+
+    client_side_socket.connect(server_endpoint);
+    acceptor.accept(server_side_socket);
+
+    char read_buffer[sizeof(write_data)];
+    memset(read_buffer, 0, sizeof(read_buffer));
+    bool read_completed = false;
+    boost::asio::async_read(client_side_socket,
+        boost::asio::buffer(read_buffer),
+        bindns::bind(handle_read,
+          _1, _2, &read_completed));
+
+    bool write_completed = false;
+    boost::asio::async_write(server_side_socket,
+        boost::asio::buffer(write_data),
+        bindns::bind(handle_write,
+          _1, _2, &write_completed));
+
+    ioc.restart();
+    ioc.run();
+    BOOST_ASIO_CHECK(read_completed);
+    BOOST_ASIO_CHECK(write_completed);
+    BOOST_ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+
+    // Closing the socket must release the descriptor, even while an
+    // operation is outstanding.
+
+    bool read_eof_completed = false;
+    boost::asio::async_read(client_side_socket,
+        boost::asio::buffer(read_buffer),
+        bindns::bind(handle_read_eof,
+          _1, _2, &read_eof_completed));
+
+    server_side_socket.close();
+
+    ioc.restart();
+    ioc.run();
+    BOOST_ASIO_CHECK(read_eof_completed);
+  }
+}
+
+void test_registered_files()
+{
+  // The fixed file table is smaller than the number of sockets, so that some
+  // sockets must use their descriptors directly.
+  boost::asio::io_context ioc(
+      boost::asio::config_from_string("reactor.registered_files=2"));
+
+  test_transfer_and_close(ioc, 3);
+}
+
+void test_setup_flags()
+{
+  // Use IORING_SETUP_COOP_TASKRUN, so that completions are only available
+  // once task work has been run.
+  boost::asio::io_context ioc(
+      boost::asio::config_from_string("reactor.io_uring_setup_flags=256"));
+
+  test_transfer_and_close(ioc, 1);
+}
+
+void test_send_then_receive()
+{
+  using namespace std; // For memcmp and memset.
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+  using bindns::placeholders::_3;
+
+  io_context ioc;
+
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::socket client_side_socket(ioc);
+  ip::tcp::socket server_side_socket(ioc);
+
+  client_side_socket.connect(server_endpoint);
+  acceptor.accept(server_side_socket);
+
+  // The reply is already waiting when the receive starts.
+
+  boost::asio::write(server_side_socket, boost::asio::buffer(write_data));
+
+  char read_buffer[sizeof(write_data)];
+  memset(read_buffer, 0, sizeof(read_buffer));
+  bool send_then_receive_completed = false;
+  client_side_socket.async_send_then_receive(
+      boost::asio::buffer(write_data),
+      boost::asio::buffer(read_buffer),
+      bindns::bind(handle_send_then_receive,
+        _1, _2, _3, &send_then_receive_completed));
+
+  char server_read_buffer[sizeof(write_data)];
+  memset(server_read_buffer, 0, sizeof(server_read_buffer));
+  bool read_completed = false;
+  boost::asio::async_read(server_side_socket,
+      boost::asio::buffer(server_read_buffer),
+      bindns::bind(handle_read,
+        _1, _2, &read_completed));
+
+  ioc.run();
+  BOOST_ASIO_CHECK(send_then_receive_completed);
+  BOOST_ASIO_CHECK(read_completed);
+  BOOST_ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+  BOOST_ASIO_CHECK(
+      memcmp(server_read_buffer, write_data, sizeof(write_data)) == 0);
+
+  // The send succeeds but the peer has shut down its side of the connection,
+  // so the receive fails.
+
+  server_side_socket.shutdown(ip::tcp::socket::shutdown_send);
+
+  bool send_then_receive_eof_completed = false;
+  client_side_socket.async_send_then_receive(
+      boost::asio::buffer(write_data),
+      boost::asio::buffer(read_buffer),
+      bindns::bind(handle_send_then_receive_eof,
+        _1, _2, _3, &send_then_receive_eof_completed));
+
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(send_then_receive_eof_completed);
+
+  // The request is larger than the socket buffers, so the first send is short.
+  // All of it must be sent before the receive completes with the reply, which
+  // is already waiting.
+
+  ip::tcp::socket client_side_socket2(ioc);
+  ip::tcp::socket server_side_socket2(ioc);
+
+  client_side_socket2.connect(server_endpoint);
+  acceptor.accept(server_side_socket2);
+
+  client_side_socket2.set_option(ip::tcp::socket::send_buffer_size(4096));
+  server_side_socket2.set_option(ip::tcp::socket::receive_buffer_size(4096));
+
+  boost::asio::write(server_side_socket2, boost::asio::buffer(write_data));
+
+  std::vector<char> request(4 * 1024 * 1024, 'x');
+  bool send_then_receive_all_completed = false;
+  client_side_socket2.async_send_then_receive(
+      boost::asio::buffer(request),
+      boost::asio::buffer(read_buffer),
+      bindns::bind(handle_send_then_receive_all,
+        _1, _2, _3, request.size(), &send_then_receive_all_completed));
+
+  std::vector<char> server_request(request.size());
+  read_completed = false;
+  boost::asio::async_read(server_side_socket2,
+      boost::asio::buffer(server_request),
+      bindns::bind(handle_read_all,
+        _1, _2, server_request.size(), &read_completed));
+
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(send_then_receive_all_completed);
+  BOOST_ASIO_CHECK(read_completed);
+  BOOST_ASIO_CHECK(server_request == request);
+}
+
+struct inline_read_state
+{
+  boost::asio::ip::tcp::socket* socket;
+  char data;
+  int reads;
+  int nesting;
+  int max_nesting;
+};
+
+void start_inline_read(inline_read_state* state);
+
+void handle_inline_read(const boost::system::error_code& err,
+    size_t bytes_transferred, inline_read_state* state)
+{
+  BOOST_ASIO_CHECK(!err);
+  BOOST_ASIO_CHECK(bytes_transferred == 1);
+
+  ++state->nesting;
+  if (state->nesting > state->max_nesting)
+    state->max_nesting = state->nesting;
+  if (++state->reads < 20)
+    start_inline_read(state);
+  --state->nesting;
+}
+
+void start_inline_read(inline_read_state* state)
+{
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  state->socket->async_read_some(boost::asio::buffer(&state->data, 1),
+      bindns::bind(handle_inline_read, _1, _2, state));
+}
+
+void test_inline_completion()
+{
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  io_context ioc(config_from_string("reactor.inline_completion_depth=4"));
+
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::socket client_side_socket(ioc);
+  ip::tcp::socket server_side_socket(ioc);
+
+  client_side_socket.connect(server_endpoint);
+  acceptor.accept(server_side_socket);
+
+  // All of the data is already waiting when the reads start.
+  char data[40] = "";
+  boost::asio::write(server_side_socket, boost::asio::buffer(data));
+  while (client_side_socket.available() < sizeof(data))
+    ioc.poll();
+
+  // Without the socket option, reads are never completed inline.
+  inline_read_state state = { &client_side_socket, 0, 0, 0, 0 };
+  start_inline_read(&state);
+  BOOST_ASIO_CHECK(state.reads == 0);
+
+  ioc.run();
+  BOOST_ASIO_CHECK(state.reads == 20);
+  BOOST_ASIO_CHECK(state.max_nesting == 1);
+
+  client_side_socket.set_option(socket_base::inline_completion(true));
+  socket_base::inline_completion option;
+  client_side_socket.get_option(option);
+  BOOST_ASIO_CHECK(option.value());
+
+  // A read started outside of the io_context is never completed inline.
+  inline_read_state state2 = { &client_side_socket, 0, 0, 0, 0 };
+  start_inline_read(&state2);
+  BOOST_ASIO_CHECK(state2.reads == 0);
+
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(state2.reads == 20);
+
+#if (defined(BOOST_ASIO_HAS_EPOLL) || defined(BOOST_ASIO_HAS_KQUEUE)) \
+  && !defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  // Reads started from within a handler are performed speculatively and
+  // completed inline, up to the configured depth of nested completions below
+  // the handler that was run by the io_context.
+  BOOST_ASIO_CHECK(state2.max_nesting == 1 + 4);
+#endif // (defined(BOOST_ASIO_HAS_EPOLL) || defined(BOOST_ASIO_HAS_KQUEUE))
+       //   && !defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+}
+
 } // namespace ip_tcp_socket_runtime
 
 //------------------------------------------------------------------------------
@@ -1020,6 +1405,73 @@ void test()
       == client_endpoint.port());
 }
 
+struct exclusive_accept_handler
+{
+  boost::asio::ip::tcp::acceptor* acceptor_;
+  boost::asio::ip::tcp::socket* socket_;
+  int* accepted_;
+
+  void operator()(const boost::system::error_code& err)
+  {
+    BOOST_ASIO_CHECK(!err);
+    if (!err)
+    {
+      ++*accepted_;
+      socket_->close();
+      acceptor_->async_accept(*socket_, *this);
+    }
+  }
+};
+
+void test_exclusive()
+{
+#if defined(BOOST_ASIO_HAS_EPOLL)
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  // Two io_contexts share one listening socket, each with an accept
+  // operation outstanding at all times.
+  io_context ioc1(config_from_string("reactor.epoll_exclusive=1"));
+  io_context ioc2(config_from_string("reactor.epoll_exclusive=1"));
+
+  ip::tcp::acceptor acceptor1(ioc1, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor1.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::acceptor acceptor2(ioc2, ip::tcp::v4(),
+      ::dup(acceptor1.native_handle()));
+
+  ip::tcp::socket server_side_socket1(ioc1);
+  ip::tcp::socket server_side_socket2(ioc2);
+  int accepted1 = 0;
+  int accepted2 = 0;
+  exclusive_accept_handler handler1 =
+    { &acceptor1, &server_side_socket1, &accepted1 };
+  exclusive_accept_handler handler2 =
+    { &acceptor2, &server_side_socket2, &accepted2 };
+  acceptor1.async_accept(server_side_socket1, handler1);
+  acceptor2.async_accept(server_side_socket2, handler2);
+
+  io_context client_ioc;
+  const int num_connections = 20;
+  for (int i = 0; i < num_connections; ++i)
+  {
+    ip::tcp::socket client_side_socket(client_ioc);
+    client_side_socket.connect(server_endpoint);
+    while (accepted1 + accepted2 == i)
+    {
+      ioc1.poll();
+      ioc2.poll();
+    }
+  }
+
+  BOOST_ASIO_CHECK(accepted1 + accepted2 == num_connections);
+
+  acceptor1.close();
+  acceptor2.close();
+#endif // defined(BOOST_ASIO_HAS_EPOLL)
+}
+
 } // namespace ip_tcp_acceptor_runtime
 
 //------------------------------------------------------------------------------
@@ -1280,8 +1732,13 @@ BOOST_ASIO_TEST_SUITE
   BOOST_ASIO_TEST_CASE(ip_tcp_runtime::test)
   BOOST_ASIO_COMPILE_TEST_CASE(ip_tcp_socket_compile::test)
   BOOST_ASIO_TEST_CASE(ip_tcp_socket_runtime::test)
+  BOOST_ASIO_TEST_CASE(ip_tcp_socket_runtime::test_registered_files)
+  BOOST_ASIO_TEST_CASE(ip_tcp_socket_runtime::test_setup_flags)
+  BOOST_ASIO_TEST_CASE(ip_tcp_socket_runtime::test_send_then_receive)
+  BOOST_ASIO_TEST_CASE(ip_tcp_socket_runtime::test_inline_completion)
   BOOST_ASIO_COMPILE_TEST_CASE(ip_tcp_acceptor_compile::test)
   BOOST_ASIO_TEST_CASE(ip_tcp_acceptor_runtime::test)
+  BOOST_ASIO_TEST_CASE(ip_tcp_acceptor_runtime::test_exclusive)
   BOOST_ASIO_COMPILE_TEST_CASE(ip_tcp_resolver_compile::test)
   BOOST_ASIO_COMPILE_TEST_CASE(ip_tcp_resolver_entry_compile::test)
   BOOST_ASIO_COMPILE_TEST_CASE(ip_tcp_resolver_entry_compile::test)
@@ -407,6 +407,34 @@ void test()
         ip::udp::endpoint(ip::udp::v6(), 0), in_flags, lazy);
     (void)i21;
 
+    datagram_slot<const_buffer, ip::udp::endpoint> send_slots[1] =
+    {
+      { buffer(const_char_buffer), ip::udp::endpoint(ip::udp::v4(), 0) }
+    };
+    socket1.async_send_to_many(send_slots, 1, send_handler());
+    socket1.async_send_to_many(send_slots, 1, in_flags, send_handler());
+    socket1.async_send_to_many(send_slots, 1, immediate);
+    socket1.async_send_to_many(send_slots, 1, in_flags, immediate);
+    int i21a = socket1.async_send_to_many(send_slots, 1, lazy);
+    (void)i21a;
+    int i21b = socket1.async_send_to_many(send_slots, 1, in_flags, lazy);
+    (void)i21b;
+
+    socket1.async_send_to_segmented(buffer(const_char_buffer),
+        ip::udp::endpoint(ip::udp::v4(), 0), 1, send_handler());
+    socket1.async_send_to_segmented(buffer(const_char_buffer),
+        ip::udp::endpoint(ip::udp::v4(), 0), 1, in_flags, send_handler());
+    socket1.async_send_to_segmented(buffer(const_char_buffer),
+        ip::udp::endpoint(ip::udp::v4(), 0), 1, immediate);
+    socket1.async_send_to_segmented(buffer(const_char_buffer),
+        ip::udp::endpoint(ip::udp::v4(), 0), 1, in_flags, immediate);
+    int i21c = socket1.async_send_to_segmented(buffer(const_char_buffer),
+        ip::udp::endpoint(ip::udp::v4(), 0), 1, lazy);
+    (void)i21c;
+    int i21d = socket1.async_send_to_segmented(buffer(const_char_buffer),
+        ip::udp::endpoint(ip::udp::v4(), 0), 1, in_flags, lazy);
+    (void)i21d;
+
     socket1.receive(buffer(mutable_char_buffer));
     socket1.receive(null_buffers());
     socket1.receive(buffer(mutable_char_buffer), in_flags);
@@ -469,6 +497,47 @@ void test()
     int i29 = socket1.async_receive_from(null_buffers(),
         endpoint, in_flags, lazy);
     (void)i29;
+
+    datagram_slot<mutable_buffer, ip::udp::endpoint> receive_slots[1] =
+    {
+      datagram_slot<mutable_buffer, ip::udp::endpoint>(
+          buffer(mutable_char_buffer))
+    };
+    socket1.async_receive_from_many(receive_slots, 1, receive_handler());
+    socket1.async_receive_from_many(receive_slots, 1,
+        in_flags, receive_handler());
+    socket1.async_receive_from_many(receive_slots, 1, immediate);
+    socket1.async_receive_from_many(receive_slots, 1, in_flags, immediate);
+    int i30 = socket1.async_receive_from_many(receive_slots, 1, lazy);
+    (void)i30;
+    int i31 = socket1.async_receive_from_many(receive_slots, 1,
+        in_flags, lazy);
+    (void)i31;
+
+    std::size_t segment_size = 0;
+    socket1.async_receive_from_coalesced(buffer(mutable_char_buffer),
+        endpoint, segment_size, receive_handler());
+    socket1.async_receive_from_coalesced(buffer(mutable_char_buffer),
+        endpoint, segment_size, in_flags, receive_handler());
+    socket1.async_receive_from_coalesced(buffer(mutable_char_buffer),
+        endpoint, segment_size, immediate);
+    socket1.async_receive_from_coalesced(buffer(mutable_char_buffer),
+        endpoint, segment_size, in_flags, immediate);
+    int i32 = socket1.async_receive_from_coalesced(buffer(mutable_char_buffer),
+        endpoint, segment_size, lazy);
+    (void)i32;
+    int i33 = socket1.async_receive_from_coalesced(buffer(mutable_char_buffer),
+        endpoint, segment_size, in_flags, lazy);
+    (void)i33;
+
+#if defined(BOOST_ASIO_HAS_UDP_GSO)
+    ip::udp::segment_size segment_size_option(1200);
+    socket1.set_option(segment_size_option);
+    socket1.get_option(segment_size_option);
+    ip::udp::receive_offload receive_offload_option(true);
+    socket1.set_option(receive_offload_option);
+    socket1.get_option(receive_offload_option);
+#endif // defined(BOOST_ASIO_HAS_UDP_GSO)
   }
   catch (std::exception&)
   {
@@ -542,6 +611,199 @@ void test()
   BOOST_ASIO_CHECK(memcmp(send_msg, recv_msg, sizeof(send_msg)) == 0);
 }
 
+void handle_send_many(size_t expected_datagrams_sent,
+    const boost::system::error_code& err, size_t datagrams_sent)
+{
+  BOOST_ASIO_CHECK(!err);
+  BOOST_ASIO_CHECK(expected_datagrams_sent == datagrams_sent);
+}
+
+void handle_recv_many(size_t* datagrams_recvd,
+    const boost::system::error_code& err, size_t datagrams)
+{
+  BOOST_ASIO_CHECK(!err);
+  BOOST_ASIO_CHECK(datagrams > 0);
+  *datagrams_recvd += datagrams;
+}
+
+void test_many()
+{
+  using namespace std; // For memcmp.
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  io_context ioc;
+
+  ip::udp::socket s1(ioc, ip::udp::endpoint(ip::udp::v4(), 0));
+  ip::udp::endpoint target_endpoint1 = s1.local_endpoint();
+  target_endpoint1.address(ip::address_v4::loopback());
+
+  ip::udp::socket s2(ioc, ip::udp::endpoint(ip::udp::v4(), 0));
+  ip::udp::endpoint target_endpoint2 = s2.local_endpoint();
+  target_endpoint2.address(ip::address_v4::loopback());
+
+  ip::udp::socket s3(ioc, ip::udp::endpoint(ip::udp::v4(), 0));
+  ip::udp::endpoint sender_endpoint = s3.local_endpoint();
+  sender_endpoint.address(ip::address_v4::loopback());
+
+  // Send a batch of datagrams to two different destinations.
+  const char send_msg1[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  const char send_msg2[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+  datagram_slot<const_buffer, ip::udp::endpoint> send_slots[3] =
+  {
+    { buffer(send_msg1), target_endpoint1 },
+    { buffer(send_msg2), target_endpoint1 },
+    { buffer(send_msg1), target_endpoint2 }
+  };
+
+  s3.async_send_to_many(send_slots, 3,
+      bindns::bind(handle_send_many, 3, _1, _2));
+
+  ioc.run();
+
+  BOOST_ASIO_CHECK(send_slots[0].bytes_transferred() == sizeof(send_msg1));
+  BOOST_ASIO_CHECK(send_slots[1].bytes_transferred() == sizeof(send_msg2));
+  BOOST_ASIO_CHECK(send_slots[2].bytes_transferred() == sizeof(send_msg1));
+
+  // Receive the datagrams queued on the first destination, leaving room for
+  // more datagrams than were sent.
+  char recv_msgs[4][64];
+  datagram_slot<mutable_buffer, ip::udp::endpoint> recv_slots[4];
+  for (int i = 0; i < 4; ++i)
+    recv_slots[i].buffer(buffer(recv_msgs[i]));
+
+  size_t datagrams_recvd = 0;
+  while (datagrams_recvd < 2)
+  {
+    s1.async_receive_from_many(recv_slots + datagrams_recvd,
+        4 - datagrams_recvd,
+        bindns::bind(handle_recv_many, &datagrams_recvd, _1, _2));
+
+    ioc.restart();
+    ioc.run();
+  }
+
+  BOOST_ASIO_CHECK(datagrams_recvd == 2);
+  BOOST_ASIO_CHECK(recv_slots[0].bytes_transferred() == sizeof(send_msg1));
+  BOOST_ASIO_CHECK(memcmp(recv_msgs[0], send_msg1, sizeof(send_msg1)) == 0);
+  BOOST_ASIO_CHECK(recv_slots[0].endpoint() == sender_endpoint);
+  BOOST_ASIO_CHECK(recv_slots[1].bytes_transferred() == sizeof(send_msg2));
+  BOOST_ASIO_CHECK(memcmp(recv_msgs[1], send_msg2, sizeof(send_msg2)) == 0);
+  BOOST_ASIO_CHECK(recv_slots[1].endpoint() == sender_endpoint);
+
+  // The second destination receives the remaining datagram.
+  datagrams_recvd = 0;
+  s2.async_receive_from_many(recv_slots, 4,
+      bindns::bind(handle_recv_many, &datagrams_recvd, _1, _2));
+
+  ioc.restart();
+  ioc.run();
+
+  BOOST_ASIO_CHECK(datagrams_recvd == 1);
+  BOOST_ASIO_CHECK(recv_slots[0].bytes_transferred() == sizeof(send_msg1));
+  BOOST_ASIO_CHECK(memcmp(recv_msgs[0], send_msg1, sizeof(send_msg1)) == 0);
+  BOOST_ASIO_CHECK(recv_slots[0].endpoint() == sender_endpoint);
+}
+
+void handle_send_segmented(size_t expected_bytes_sent,
+    const boost::system::error_code& err, size_t bytes_sent)
+{
+#if defined(BOOST_ASIO_HAS_UDP_GSO)
+  BOOST_ASIO_CHECK(!err);
+  BOOST_ASIO_CHECK(expected_bytes_sent == bytes_sent);
+#else // defined(BOOST_ASIO_HAS_UDP_GSO)
+  BOOST_ASIO_CHECK(err == boost::asio::error::operation_not_supported);
+  (void)expected_bytes_sent;
+  (void)bytes_sent;
+#endif // defined(BOOST_ASIO_HAS_UDP_GSO)
+}
+
+void handle_recv_coalesced(size_t* bytes_recvd,
+    const boost::system::error_code& err, size_t bytes)
+{
+  BOOST_ASIO_CHECK(!err);
+  *bytes_recvd = bytes;
+}
+
+void test_segmented()
+{
+  using namespace std; // For memcmp.
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  io_context ioc;
+
+  ip::udp::socket s1(ioc, ip::udp::endpoint(ip::udp::v4(), 0));
+  ip::udp::endpoint target_endpoint = s1.local_endpoint();
+  target_endpoint.address(ip::address_v4::loopback());
+
+  ip::udp::socket s2(ioc, ip::udp::endpoint(ip::udp::v4(), 0));
+
+#if defined(BOOST_ASIO_HAS_UDP_GSO)
+  s1.set_option(ip::udp::receive_offload(true));
+
+  ip::udp::segment_size segment_size_option;
+  s2.get_option(segment_size_option);
+  BOOST_ASIO_CHECK(segment_size_option.value() == 0);
+#endif // defined(BOOST_ASIO_HAS_UDP_GSO)
+
+  // Send three equally sized datagrams in a single operation.
+  const char send_msg[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+  const size_t send_size = sizeof(send_msg) - 1;
+  const size_t send_segment_size = send_size / 3;
+
+  s2.async_send_to_segmented(buffer(send_msg, send_size),
+      target_endpoint, send_segment_size,
+      bindns::bind(handle_send_segmented, send_size, _1, _2));
+
+  ioc.run();
+
+#if !defined(BOOST_ASIO_HAS_UDP_GSO)
+  // Without segmentation offload, send the datagrams one at a time instead.
+  for (size_t i = 0; i < 3; ++i)
+  {
+    s2.send_to(buffer(send_msg + i * send_segment_size,
+          send_segment_size), target_endpoint);
+  }
+#endif // !defined(BOOST_ASIO_HAS_UDP_GSO)
+
+  // The datagrams may be received individually or coalesced, but each one
+  // must have the segment size used for sending.
+  char recv_msg[sizeof(send_msg)];
+  size_t total_bytes_recvd = 0;
+  while (total_bytes_recvd < send_size)
+  {
+    ip::udp::endpoint sender_endpoint;
+    size_t segment_size = 0;
+    size_t bytes_recvd = 0;
+    s1.async_receive_from_coalesced(
+        buffer(recv_msg + total_bytes_recvd, send_size - total_bytes_recvd),
+        sender_endpoint, segment_size,
+        bindns::bind(handle_recv_coalesced, &bytes_recvd, _1, _2));
+
+    ioc.restart();
+    ioc.run();
+
+    BOOST_ASIO_CHECK(bytes_recvd > 0);
+    BOOST_ASIO_CHECK(segment_size == send_segment_size);
+    BOOST_ASIO_CHECK(sender_endpoint.port() == s2.local_endpoint().port());
+    if (bytes_recvd == 0)
+      break;
+    total_bytes_recvd += bytes_recvd;
+  }
+
+  BOOST_ASIO_CHECK(total_bytes_recvd == send_size);
+  BOOST_ASIO_CHECK(memcmp(recv_msg, send_msg, send_size) == 0);
+}
+
 } // namespace ip_udp_socket_runtime
 
 //------------------------------------------------------------------------------
@@ -671,5 +933,7 @@ BOOST_ASIO_TEST_SUITE
   "ip/udp",
   BOOST_ASIO_COMPILE_TEST_CASE(ip_udp_socket_compile::test)
   BOOST_ASIO_TEST_CASE(ip_udp_socket_runtime::test)
+  BOOST_ASIO_TEST_CASE(ip_udp_socket_runtime::test_many)
+  BOOST_ASIO_TEST_CASE(ip_udp_socket_runtime::test_segmented)
   BOOST_ASIO_COMPILE_TEST_CASE(ip_udp_resolver_compile::test)
 )
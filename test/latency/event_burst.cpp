@@ -0,0 +1,172 @@
+//
+// event_burst.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the time taken to dispatch a burst of readiness events spread over
+// many descriptors. Compare different values of the reactor.epoll_batch_size
+// and reactor.io_object_slab_size configuration options, e.g.
+//
+//   event_burst 10000 1000 128 1 1000
+//   event_burst 10000 1000 1024 256 1000
+
+#include <boost/asio/config.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/local/connect_pair.hpp>
+#include <boost/asio/write.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+
+using boost::asio::local::stream_protocol;
+
+class reader
+{
+public:
+  reader(boost::asio::io_context& io_context, std::size_t& remaining)
+    : socket_(io_context),
+      peer_(io_context),
+      remaining_(remaining)
+  {
+    boost::asio::local::connect_pair(socket_, peer_);
+  }
+
+  void start()
+  {
+    socket_.async_read_some(boost::asio::buffer(data_), handler(this));
+  }
+
+  void send()
+  {
+    char c = 0;
+    boost::asio::write(peer_, boost::asio::buffer(&c, 1));
+  }
+
+private:
+  struct handler
+  {
+    explicit handler(reader* r)
+      : r_(r)
+    {
+    }
+
+    void operator()(const boost::system::error_code& ec, std::size_t)
+    {
+      if (!ec)
+      {
+        --r_->remaining_;
+        r_->start();
+      }
+    }
+
+    reader* r_;
+  };
+
+  stream_protocol::socket socket_;
+  stream_protocol::socket peer_;
+  std::size_t& remaining_;
+  char data_[64];
+};
+
+int main(int argc, char* argv[])
+{
+  if (argc != 6)
+  {
+    std::fprintf(stderr,
+        "Usage: event_burst <nsockets> <burst> "
+        "<batch_size> <slab_size> <iterations>\n");
+    return 1;
+  }
+
+  std::size_t num_sockets = std::atoi(argv[1]);
+  std::size_t burst = std::atoi(argv[2]);
+  int batch_size = std::atoi(argv[3]);
+  int slab_size = std::atoi(argv[4]);
+  int iterations = std::atoi(argv[5]);
+
+  if (num_sockets == 0 || burst == 0 || burst > num_sockets)
+  {
+    std::fprintf(stderr, "Invalid arguments\n");
+    return 1;
+  }
+
+  std::string settings =
+    "reactor.epoll_batch_size=" + std::to_string(batch_size) + "\n"
+    "reactor.io_object_slab_size=" + std::to_string(slab_size) + "\n";
+  boost::asio::config_from_string config(settings);
+  boost::asio::io_context io_context(config);
+  std::minstd_rand rng;
+  std::size_t remaining = 0;
+
+  // Interleave the sockets with other allocations, as would happen in a
+  // long-running server, so that individually allocated per-descriptor state
+  // is not laid out contiguously by chance.
+  std::uniform_int_distribution<std::size_t> sizes(16, 512);
+  std::vector<reader*> readers;
+  std::vector<std::vector<char>> ballast;
+  for (std::size_t i = 0; i < num_sockets; ++i)
+  {
+    readers.push_back(new reader(io_context, remaining));
+    readers.back()->start();
+    ballast.push_back(std::vector<char>(sizes(rng)));
+  }
+
+  std::vector<std::size_t> order(num_sockets);
+  for (std::size_t i = 0; i < num_sockets; ++i)
+    order[i] = i;
+
+  io_context.poll();
+
+  unsigned long long total_nsec = 0;
+  unsigned long long max_nsec = 0;
+  for (int i = 0; i < iterations; ++i)
+  {
+    // Make a burst of descriptors ready, chosen at random.
+    std::shuffle(order.begin(), order.end(), rng);
+    for (std::size_t j = 0; j < burst; ++j)
+      readers[order[j]]->send();
+    remaining = burst;
+
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    while (remaining > 0)
+      io_context.run_one();
+    unsigned long long nsec =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start).count();
+
+    total_nsec += nsec;
+    max_nsec = (std::max)(max_nsec, nsec);
+  }
+
+  std::printf("batch %d, slab %d: burst mean %.1f usec max %.1f usec, "
+      "%.1f nsec/event\n", batch_size, slab_size,
+      iterations ? total_nsec / 1000.0 / iterations : 0.0,
+      max_nsec / 1000.0,
+      iterations ? static_cast<double>(total_nsec) / iterations / burst : 0.0);
+
+  for (std::size_t i = 0; i < readers.size(); ++i)
+    delete readers[i];
+}
+
+#else // defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+
+int main()
+{
+  std::fprintf(stderr, "Local sockets not supported on this platform\n");
+  return 1;
+}
+
+#endif // defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
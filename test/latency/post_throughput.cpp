@@ -0,0 +1,109 @@
+//
+// post_throughput.cpp
+// ~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the rate at which a thread pool can post and complete handlers, as
+// the number of threads is increased. Each chain of handlers posts its next
+// handler until the chain's length is reached. Compare different values of the
+// scheduler.work_count_batch configuration option, e.g.
+//
+//   post_throughput 8 64 100000 1
+//   post_throughput 8 64 100000 64
+
+#include <boost/asio/config.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+class chain
+{
+public:
+  chain(boost::asio::thread_pool& pool, long length)
+    : pool_(pool),
+      remaining_(length)
+  {
+  }
+
+  void start()
+  {
+    boost::asio::post(pool_, handler(this));
+  }
+
+private:
+  struct handler
+  {
+    explicit handler(chain* c)
+      : c_(c)
+    {
+    }
+
+    void operator()()
+    {
+      if (--c_->remaining_ > 0)
+        c_->start();
+    }
+
+    chain* c_;
+  };
+
+  boost::asio::thread_pool& pool_;
+  long remaining_;
+};
+
+int main(int argc, char* argv[])
+{
+  if (argc != 5)
+  {
+    std::fprintf(stderr,
+        "Usage: post_throughput <nthreads> <nchains> "
+        "<chain_length> <work_count_batch>\n");
+    return 1;
+  }
+
+  int num_threads = std::atoi(argv[1]);
+  int num_chains = std::atoi(argv[2]);
+  long chain_length = std::atol(argv[3]);
+  long batch = std::atol(argv[4]);
+
+  if (num_threads <= 0 || num_chains <= 0 || chain_length <= 0)
+  {
+    std::fprintf(stderr, "Invalid arguments\n");
+    return 1;
+  }
+
+  std::string settings =
+    "scheduler.work_count_batch=" + std::to_string(batch) + "\n";
+  boost::asio::config_from_string config(settings);
+  boost::asio::thread_pool pool(num_threads, config);
+
+  chain** chains = new chain*[num_chains];
+  for (int i = 0; i < num_chains; ++i)
+    chains[i] = new chain(pool, chain_length);
+
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+
+  for (int i = 0; i < num_chains; ++i)
+    chains[i]->start();
+  pool.wait();
+
+  double sec = std::chrono::duration_cast<std::chrono::duration<double>>(
+      std::chrono::steady_clock::now() - start).count();
+
+  double handlers = static_cast<double>(num_chains) * chain_length;
+  std::printf("threads %d, batch %ld: %.0f handlers/sec, %.1f nsec/handler\n",
+      num_threads, batch, handlers / sec, sec * 1e9 / handlers);
+
+  for (int i = 0; i < num_chains; ++i)
+    delete chains[i];
+  delete[] chains;
+}
@@ -0,0 +1,101 @@
+//
+// strand_throughput.cpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the rate at which handlers can be posted to, and run by, a number
+// of strands sharing a thread pool. Each chain of handlers posts its next
+// handler to its own strand until the chain's length is reached, e.g.
+//
+//   strand_throughput 8 1000 1000
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+class chain
+{
+public:
+  chain(boost::asio::thread_pool& pool, long length)
+    : strand_(boost::asio::make_strand(pool)),
+      remaining_(length)
+  {
+  }
+
+  void start()
+  {
+    boost::asio::post(strand_, handler(this));
+  }
+
+private:
+  struct handler
+  {
+    explicit handler(chain* c)
+      : c_(c)
+    {
+    }
+
+    void operator()()
+    {
+      if (--c_->remaining_ > 0)
+        c_->start();
+    }
+
+    chain* c_;
+  };
+
+  boost::asio::strand<boost::asio::thread_pool::executor_type> strand_;
+  long remaining_;
+};
+
+int main(int argc, char* argv[])
+{
+  if (argc != 4)
+  {
+    std::fprintf(stderr,
+        "Usage: strand_throughput <nthreads> <nchains> <chain_length>\n");
+    return 1;
+  }
+
+  int num_threads = std::atoi(argv[1]);
+  int num_chains = std::atoi(argv[2]);
+  long chain_length = std::atol(argv[3]);
+
+  if (num_threads <= 0 || num_chains <= 0 || chain_length <= 0)
+  {
+    std::fprintf(stderr, "Invalid arguments\n");
+    return 1;
+  }
+
+  boost::asio::thread_pool pool(num_threads);
+
+  chain** chains = new chain*[num_chains];
+  for (int i = 0; i < num_chains; ++i)
+    chains[i] = new chain(pool, chain_length);
+
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+
+  for (int i = 0; i < num_chains; ++i)
+    chains[i]->start();
+  pool.wait();
+
+  double sec = std::chrono::duration_cast<std::chrono::duration<double>>(
+      std::chrono::steady_clock::now() - start).count();
+
+  double handlers = static_cast<double>(num_chains) * chain_length;
+  std::printf("threads %d, strands %d: %.0f handlers/sec, %.1f nsec/handler\n",
+      num_threads, num_chains, handlers / sec, sec * 1e9 / handlers);
+
+  for (int i = 0; i < num_chains; ++i)
+    delete chains[i];
+  delete[] chains;
+}
@@ -8,6 +8,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <boost/asio/config.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/read.hpp>
@@ -16,6 +17,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <string>
 #include <vector>
 
 using boost::asio::ip::tcp;
@@ -25,10 +27,12 @@ using boost::asio::ip::tcp;
 class tcp_server : boost::asio::coroutine
 {
 public:
-  tcp_server(tcp::acceptor& acceptor, std::size_t buf_size) :
+  tcp_server(tcp::acceptor& acceptor, std::size_t buf_size,
+      bool inline_completion) :
     acceptor_(acceptor),
     socket_(acceptor_.get_executor()),
-    buffer_(buf_size)
+    buffer_(buf_size),
+    inline_completion_(inline_completion)
   {
   }
 
@@ -38,6 +42,9 @@ public:
     {
       yield acceptor_.async_accept(socket_, ref(this));
 
+      if (!ec && inline_completion_)
+        socket_.set_option(tcp::socket::inline_completion(true), ec);
+
       while (!ec)
       {
         yield boost::asio::async_read(socket_,
@@ -76,6 +83,7 @@ private:
   tcp::acceptor& acceptor_;
   tcp::socket socket_;
   std::vector<unsigned char> buffer_;
+  bool inline_completion_;
   tcp::endpoint sender_;
 };
 
@@ -83,11 +91,11 @@ private:
 
 int main(int argc, char* argv[])
 {
-  if (argc != 5)
+  if (argc != 5 && argc != 6)
   {
     std::fprintf(stderr,
         "Usage: tcp_server <port> <nconns> "
-        "<bufsize> {spin|block}\n");
+        "<bufsize> {spin|block} [<inline_depth>]\n");
     return 1;
   }
 
@@ -96,13 +104,22 @@ int main(int argc, char* argv[])
   std::size_t buf_size = std::atoi(argv[3]);
   bool spin = (std::strcmp(argv[4], "spin") == 0);
 
-  boost::asio::io_context io_context(1);
+  // A non-zero inline completion depth allows a write that completes
+  // immediately to resume the coroutine without a round trip through the
+  // scheduler's queue.
+  int inline_depth = (argc == 6) ? std::atoi(argv[5]) : 0;
+
+  boost::asio::config_from_string config(
+      "scheduler.concurrency_hint=1\n"
+      "reactor.inline_completion_depth=" + std::to_string(inline_depth));
+  boost::asio::io_context io_context(config);
   tcp::acceptor acceptor(io_context, tcp::endpoint(tcp::v4(), port));
   std::vector<boost::shared_ptr<tcp_server> > servers;
 
   for (int i = 0; i < max_connections; ++i)
   {
-    boost::shared_ptr<tcp_server> s(new tcp_server(acceptor, buf_size));
+    boost::shared_ptr<tcp_server> s(
+        new tcp_server(acceptor, buf_size, inline_depth > 0));
     servers.push_back(s);
     (*s)(boost::system::error_code());
   }
@@ -0,0 +1,195 @@
+//
+// timer_churn.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the cost of timers whose deadlines change frequently, such as per
+// request timeouts that are pushed back whenever a request makes progress.
+// Build once for each reactor to compare them, e.g. with and without
+// BOOST_ASIO_HAS_IO_URING and BOOST_ASIO_DISABLE_EPOLL defined. An optional
+// sixth argument sets the timer.wheel_tick_usec configuration option, to
+// compare the timer wheel with the default heap, and an optional seventh
+// argument sets the slack of every timer.
+
+#include <boost/asio/config.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using boost::asio::steady_timer;
+
+struct timer_stats
+{
+  unsigned long long resets;
+  unsigned long long expiries;
+  unsigned long long total_lateness;
+  unsigned long long max_lateness;
+};
+
+class request_timer
+{
+public:
+  request_timer(boost::asio::io_context& io_context,
+      timer_stats& stats, std::minstd_rand& rng,
+      unsigned min_usec, unsigned max_usec, long slack_usec)
+    : timer_(io_context),
+      stats_(stats),
+      rng_(rng),
+      timeouts_(min_usec, max_usec)
+  {
+    timer_.slack(std::chrono::microseconds(slack_usec));
+  }
+
+  // Push back the deadline, cancelling any outstanding wait.
+  void reset()
+  {
+    ++stats_.resets;
+    timer_.expires_after(std::chrono::microseconds(timeouts_(rng_)));
+    timer_.async_wait(handler(this, timer_.expiry()));
+  }
+
+private:
+  struct handler
+  {
+    handler(request_timer* t, steady_timer::time_point expiry)
+      : t_(t),
+        expiry_(expiry)
+    {
+    }
+
+    void operator()(const boost::system::error_code& ec)
+    {
+      // A wait that completed before the timer was reset is ignored.
+      if (!ec && expiry_ == t_->timer_.expiry())
+        t_->expired();
+    }
+
+    request_timer* t_;
+    steady_timer::time_point expiry_;
+  };
+
+  void expired()
+  {
+    unsigned long long lateness =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          steady_timer::clock_type::now() - timer_.expiry()).count();
+    ++stats_.expiries;
+    stats_.total_lateness += lateness;
+    stats_.max_lateness = (std::max)(stats_.max_lateness, lateness);
+    reset();
+  }
+
+  steady_timer timer_;
+  timer_stats& stats_;
+  std::minstd_rand& rng_;
+  std::uniform_int_distribution<unsigned> timeouts_;
+};
+
+// Resets a batch of randomly chosen timers, then yields to let the reactor
+// run before resetting the next batch.
+class driver
+{
+public:
+  driver(boost::asio::io_context& io_context,
+      std::vector<request_timer*>& timers,
+      std::minstd_rand& rng, std::size_t batch_size)
+    : io_context_(io_context),
+      timers_(timers),
+      rng_(rng),
+      choose_(0, timers.size() - 1),
+      batch_size_(batch_size)
+  {
+  }
+
+  void operator()()
+  {
+    for (std::size_t i = 0; i < batch_size_; ++i)
+      timers_[choose_(rng_)]->reset();
+    boost::asio::post(io_context_, *this);
+  }
+
+private:
+  boost::asio::io_context& io_context_;
+  std::vector<request_timer*>& timers_;
+  std::minstd_rand& rng_;
+  std::uniform_int_distribution<std::size_t> choose_;
+  std::size_t batch_size_;
+};
+
+int main(int argc, char* argv[])
+{
+  if (argc < 6 || argc > 8)
+  {
+    std::fprintf(stderr,
+        "Usage: timer_churn <ntimers> <batchsize> <min_usec> <max_usec> "
+        "<seconds> [<wheel_tick_usec> [<slack_usec>]]\n");
+    return 1;
+  }
+
+  std::size_t num_timers = std::atoi(argv[1]);
+  std::size_t batch_size = std::atoi(argv[2]);
+  unsigned min_usec = std::atoi(argv[3]);
+  unsigned max_usec = std::atoi(argv[4]);
+  int seconds = std::atoi(argv[5]);
+  long wheel_tick_usec = argc > 6 ? std::atol(argv[6]) : 0;
+  long slack_usec = argc > 7 ? std::atol(argv[7]) : 0;
+
+  if (num_timers == 0 || min_usec > max_usec)
+  {
+    std::fprintf(stderr, "Invalid arguments\n");
+    return 1;
+  }
+
+  std::string settings =
+    "scheduler.concurrency_hint=1\n"
+    "timer.wheel_tick_usec=" + std::to_string(wheel_tick_usec) + "\n";
+  boost::asio::config_from_string config(settings);
+  boost::asio::io_context io_context(config);
+  std::minstd_rand rng;
+  timer_stats stats = { 0, 0, 0, 0 };
+
+  std::vector<request_timer*> timers;
+  for (std::size_t i = 0; i < num_timers; ++i)
+  {
+    timers.push_back(new request_timer(
+          io_context, stats, rng, min_usec, max_usec, slack_usec));
+    timers.back()->reset();
+  }
+
+  if (batch_size > 0)
+    boost::asio::post(io_context,
+        driver(io_context, timers, rng, batch_size));
+
+  io_context.run_for(std::chrono::seconds(seconds));
+
+#if defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  const char* reactor = "io_uring";
+#elif defined(BOOST_ASIO_HAS_EPOLL)
+  const char* reactor = "epoll";
+#else
+  const char* reactor = "other";
+#endif
+
+  std::printf("%s, wheel tick %ld usec, slack %ld usec: %.0f resets/sec, "
+      "%.0f expiries/sec, lateness mean %.1f usec max %llu usec\n",
+      reactor, wheel_tick_usec, slack_usec,
+      static_cast<double>(stats.resets) / seconds,
+      static_cast<double>(stats.expiries) / seconds,
+      stats.expiries
+        ? static_cast<double>(stats.total_lateness) / stats.expiries : 0.0,
+      stats.max_lateness);
+
+  for (std::size_t i = 0; i < timers.size(); ++i)
+    delete timers[i];
+}
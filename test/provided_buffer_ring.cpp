@@ -0,0 +1,222 @@
+//
+// provided_buffer_ring.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include <boost/asio/provided_buffer_ring.hpp>
+
+#include <cstring>
+#include <functional>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/asio/write.hpp>
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// provided_buffer_ring_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of receives that select
+// their storage from a provided_buffer_ring.
+
+namespace provided_buffer_ring_runtime {
+
+static const char write_data[]
+  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+void handle_receive(const boost::system::error_code& err,
+    boost::asio::provided_buffer b, boost::asio::provided_buffer* result)
+{
+  BOOST_ASIO_CHECK(!err);
+  *result = b;
+}
+
+void handle_receive_no_buffer(const boost::system::error_code& err,
+    boost::asio::provided_buffer b, bool* called)
+{
+  *called = true;
+  BOOST_ASIO_CHECK(err == boost::asio::error::no_buffer_space);
+  BOOST_ASIO_CHECK(b.id() == -1);
+}
+
+void handle_receive_eof(const boost::system::error_code& err,
+    boost::asio::provided_buffer b, bool* called)
+{
+  *called = true;
+  BOOST_ASIO_CHECK(err == boost::asio::error::eof);
+  BOOST_ASIO_CHECK(b.id() == -1);
+  BOOST_ASIO_CHECK(b.size() == 0);
+}
+
+void test()
+{
+  using namespace std; // For memcmp.
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  io_context ioc;
+
+  // Invalid ring sizes.
+
+  bool threw = false;
+  try
+  {
+    boost::asio::provided_buffer_ring bad_ring(ioc, 3, 64);
+  }
+  catch (boost::system::system_error& e)
+  {
+    threw = true;
+    BOOST_ASIO_CHECK(e.code() == boost::asio::error::invalid_argument);
+  }
+  BOOST_ASIO_CHECK(threw);
+
+  boost::asio::provided_buffer_ring ring(ioc.get_executor(), 1, 128);
+  BOOST_ASIO_CHECK(ring.buffer_count() == 1);
+  BOOST_ASIO_CHECK(ring.buffer_size() == 128);
+
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::socket client_side_socket(ioc);
+  ip::tcp::socket server_side_socket(ioc);
+
+  client_side_socket.connect(server_endpoint);
+  acceptor.accept(server_side_socket);
+
+  // Receive into a buffer selected from the ring.
+
+  boost::asio::provided_buffer result;
+  client_side_socket.async_receive(ring,
+      bindns::bind(handle_receive, _1, _2, &result));
+
+  boost::asio::write(server_side_socket, boost::asio::buffer(write_data));
+
+  ioc.run();
+  BOOST_ASIO_CHECK(result.id() == 0);
+  BOOST_ASIO_CHECK(result.size() == sizeof(write_data));
+  BOOST_ASIO_CHECK(memcmp(result.data(), write_data, sizeof(write_data)) == 0);
+
+  // A receive fails when all buffers in the ring are in use.
+
+  bool no_buffer_completed = false;
+  client_side_socket.async_receive(ring, 0,
+      bindns::bind(handle_receive_no_buffer, _1, _2, &no_buffer_completed));
+
+  boost::asio::write(server_side_socket, boost::asio::buffer(write_data));
+
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(no_buffer_completed);
+
+  // Recycled buffers are selected again.
+
+  ring.recycle(result);
+  result = boost::asio::provided_buffer();
+  client_side_socket.async_receive(ring,
+      bindns::bind(handle_receive, _1, _2, &result));
+
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(result.id() == 0);
+  BOOST_ASIO_CHECK(result.size() == sizeof(write_data));
+  BOOST_ASIO_CHECK(memcmp(result.data(), write_data, sizeof(write_data)) == 0);
+  ring.recycle(result);
+
+  // A receive when the peer closes the socket fails with eof and does not
+  // consume a buffer.
+
+  bool eof_completed = false;
+  client_side_socket.async_receive(ring,
+      bindns::bind(handle_receive_eof, _1, _2, &eof_completed));
+
+  server_side_socket.close();
+
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(eof_completed);
+}
+
+void handle_receive_datagram(const boost::system::error_code& err,
+    boost::asio::provided_buffer b, boost::asio::provided_buffer_ring* ring,
+    int* count)
+{
+  using namespace std; // For memcmp.
+
+  BOOST_ASIO_CHECK(!err);
+  BOOST_ASIO_CHECK(b.size() == sizeof(write_data));
+  BOOST_ASIO_CHECK(memcmp(b.data(), write_data, sizeof(write_data)) == 0);
+  ring->recycle(b);
+  ++*count;
+}
+
+void test_multishot_datagram()
+{
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  io_context ioc;
+
+  boost::asio::provided_buffer_ring ring(ioc, 4, 128);
+
+  ip::udp::socket receiver(ioc, ip::udp::endpoint(ip::udp::v4(), 0));
+  ip::udp::endpoint target_endpoint = receiver.local_endpoint();
+  target_endpoint.address(ip::address_v4::loopback());
+
+  ip::udp::socket sender(ioc, ip::udp::endpoint(ip::udp::v4(), 0));
+
+  // Datagrams that arrive before and while receives are outstanding are each
+  // delivered to exactly one receive.
+
+  receiver.set_option(socket_base::multishot_receive(true));
+
+  int count = 0;
+  receiver.async_receive(ring,
+      bindns::bind(handle_receive_datagram, _1, _2, &ring, &count));
+
+  for (int i = 0; i < 3; ++i)
+    sender.send_to(boost::asio::buffer(write_data), target_endpoint);
+
+  ioc.run();
+  BOOST_ASIO_CHECK(count == 1);
+
+  receiver.async_receive(ring, 0,
+      bindns::bind(handle_receive_datagram, _1, _2, &ring, &count));
+  receiver.async_receive(ring, 0,
+      bindns::bind(handle_receive_datagram, _1, _2, &ring, &count));
+
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(count == 3);
+}
+
+} // namespace provided_buffer_ring_runtime
+
+//------------------------------------------------------------------------------
+
+BOOST_ASIO_TEST_SUITE
+(
+  "provided_buffer_ring",
+  BOOST_ASIO_TEST_CASE(provided_buffer_ring_runtime::test)
+  BOOST_ASIO_TEST_CASE(provided_buffer_ring_runtime::test_multishot_datagram)
+)
@@ -0,0 +1,132 @@
+//
+// sharded_acceptor.cpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include <boost/asio/sharded_acceptor.hpp>
+
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// sharded_acceptor_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that connections are accepted by each shard and
+// remain associated with the shard that accepted them.
+
+namespace sharded_acceptor_runtime {
+
+using namespace boost::asio;
+namespace bindns = std;
+typedef sharded_acceptor<ip::tcp> acceptor_group;
+
+const int num_connections = 32;
+
+void close_acceptor(acceptor_group::acceptor_type* acceptor)
+{
+  acceptor->close();
+}
+
+void start_accept(io_context_group* group, acceptor_group* acceptors,
+    std::size_t index, std::atomic<int>* count);
+
+void handle_accept(io_context_group* group, acceptor_group* acceptors,
+    std::size_t index, std::atomic<int>* count,
+    const boost::system::error_code& err,
+    ip::tcp::socket::rebind_executor<
+      io_context_group::executor_type>::other socket)
+{
+  if (err)
+    return;
+
+  // The accepted socket belongs to the accepting shard.
+  BOOST_ASIO_CHECK(group->get_executor(index).running_in_this_thread());
+  BOOST_ASIO_CHECK(socket.get_executor() == group->get_executor(index));
+
+  if (++(*count) == num_connections)
+  {
+    for (std::size_t i = 0; i < acceptors->size(); ++i)
+    {
+      boost::asio::post(group->get_executor(i),
+          bindns::bind(close_acceptor, &acceptors->get_acceptor(i)));
+    }
+  }
+
+  start_accept(group, acceptors, index, count);
+}
+
+void start_accept(io_context_group* group, acceptor_group* acceptors,
+    std::size_t index, std::atomic<int>* count)
+{
+  acceptors->get_acceptor(index).async_accept(
+      bindns::bind(handle_accept, group, acceptors, index, count,
+        bindns::placeholders::_1, bindns::placeholders::_2));
+}
+
+void run_test(bool pin_threads, acceptor_group::steering_type steering)
+{
+  std::atomic<int> count(0);
+
+  io_context_group group(2, pin_threads);
+  ip::tcp::endpoint endpoint(ip::address_v4::loopback(), 0);
+  acceptor_group acceptors(group, endpoint, steering);
+
+  BOOST_ASIO_CHECK(acceptors.size() == 2);
+  BOOST_ASIO_CHECK(acceptors.local_endpoint().port() != 0);
+  BOOST_ASIO_CHECK(acceptors.get_acceptor(0).local_endpoint()
+      == acceptors.get_acceptor(1).local_endpoint());
+
+  for (std::size_t i = 0; i < acceptors.size(); ++i)
+  {
+    boost::asio::post(group.get_executor(i),
+        bindns::bind(start_accept, &group, &acceptors, i, &count));
+  }
+
+  io_context ioc;
+  std::vector<ip::tcp::socket> clients;
+  for (int i = 0; i < num_connections; ++i)
+  {
+    clients.emplace_back(ioc);
+    clients.back().connect(acceptors.local_endpoint());
+  }
+
+  group.join();
+
+  BOOST_ASIO_CHECK(count == num_connections);
+}
+
+void test()
+{
+  run_test(false, acceptor_group::steer_none);
+  run_test(true, acceptor_group::steer_incoming_cpu);
+#if defined(BOOST_ASIO_HAS_REUSEPORT_CBPF)
+  run_test(true, acceptor_group::steer_cpu_program);
+#endif // defined(BOOST_ASIO_HAS_REUSEPORT_CBPF)
+}
+
+} // namespace sharded_acceptor_runtime
+
+//------------------------------------------------------------------------------
+
+BOOST_ASIO_TEST_SUITE
+(
+  "sharded_acceptor",
+  BOOST_ASIO_TEST_CASE(sharded_acceptor_runtime::test)
+)
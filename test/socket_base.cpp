@@ -177,6 +177,50 @@ void test()
     (void)static_cast<bool>(!enable_connection_aborted1);
     (void)static_cast<bool>(enable_connection_aborted1.value());
 
+    // multishot_accept class.
+
+    socket_base::multishot_accept multishot_accept1(true);
+    sock.set_option(multishot_accept1);
+    socket_base::multishot_accept multishot_accept2;
+    sock.get_option(multishot_accept2);
+    multishot_accept1 = true;
+    (void)static_cast<bool>(multishot_accept1);
+    (void)static_cast<bool>(!multishot_accept1);
+    (void)static_cast<bool>(multishot_accept1.value());
+
+    // multishot_receive class.
+
+    socket_base::multishot_receive multishot_receive1(true);
+    sock.set_option(multishot_receive1);
+    socket_base::multishot_receive multishot_receive2;
+    sock.get_option(multishot_receive2);
+    multishot_receive1 = true;
+    (void)static_cast<bool>(multishot_receive1);
+    (void)static_cast<bool>(!multishot_receive1);
+    (void)static_cast<bool>(multishot_receive1.value());
+
+    // zero_copy_send class.
+
+    socket_base::zero_copy_send zero_copy_send1(true);
+    sock.set_option(zero_copy_send1);
+    socket_base::zero_copy_send zero_copy_send2;
+    sock.get_option(zero_copy_send2);
+    zero_copy_send1 = true;
+    (void)static_cast<bool>(zero_copy_send1);
+    (void)static_cast<bool>(!zero_copy_send1);
+    (void)static_cast<bool>(zero_copy_send1.value());
+
+    // inline_completion class.
+
+    socket_base::inline_completion inline_completion1(true);
+    sock.set_option(inline_completion1);
+    socket_base::inline_completion inline_completion2;
+    sock.get_option(inline_completion2);
+    inline_completion1 = true;
+    (void)static_cast<bool>(inline_completion1);
+    (void)static_cast<bool>(!inline_completion1);
+    (void)static_cast<bool>(inline_completion1.value());
+
     // bytes_readable class.
 
     socket_base::bytes_readable bytes_readable;
@@ -631,6 +675,126 @@ void test()
   BOOST_ASIO_CHECK(!static_cast<bool>(enable_connection_aborted4));
   BOOST_ASIO_CHECK(!enable_connection_aborted4);
 
+  // multishot_accept class.
+
+  socket_base::multishot_accept multishot_accept1(true);
+  BOOST_ASIO_CHECK(multishot_accept1.value());
+  BOOST_ASIO_CHECK(static_cast<bool>(multishot_accept1));
+  BOOST_ASIO_CHECK(!!multishot_accept1);
+  tcp_acceptor.set_option(multishot_accept1, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::multishot_accept multishot_accept2;
+  tcp_acceptor.get_option(multishot_accept2, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  BOOST_ASIO_CHECK(multishot_accept2.value());
+  BOOST_ASIO_CHECK(static_cast<bool>(multishot_accept2));
+  BOOST_ASIO_CHECK(!!multishot_accept2);
+
+  socket_base::multishot_accept multishot_accept3(false);
+  BOOST_ASIO_CHECK(!multishot_accept3.value());
+  BOOST_ASIO_CHECK(!static_cast<bool>(multishot_accept3));
+  BOOST_ASIO_CHECK(!multishot_accept3);
+  tcp_acceptor.set_option(multishot_accept3, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::multishot_accept multishot_accept4;
+  tcp_acceptor.get_option(multishot_accept4, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  BOOST_ASIO_CHECK(!multishot_accept4.value());
+  BOOST_ASIO_CHECK(!static_cast<bool>(multishot_accept4));
+  BOOST_ASIO_CHECK(!multishot_accept4);
+
+  // multishot_receive class.
+
+  socket_base::multishot_receive multishot_receive1(true);
+  BOOST_ASIO_CHECK(multishot_receive1.value());
+  BOOST_ASIO_CHECK(static_cast<bool>(multishot_receive1));
+  BOOST_ASIO_CHECK(!!multishot_receive1);
+  udp_sock.set_option(multishot_receive1, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::multishot_receive multishot_receive2;
+  udp_sock.get_option(multishot_receive2, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  BOOST_ASIO_CHECK(multishot_receive2.value());
+  BOOST_ASIO_CHECK(static_cast<bool>(multishot_receive2));
+  BOOST_ASIO_CHECK(!!multishot_receive2);
+
+  socket_base::multishot_receive multishot_receive3(false);
+  BOOST_ASIO_CHECK(!multishot_receive3.value());
+  BOOST_ASIO_CHECK(!static_cast<bool>(multishot_receive3));
+  BOOST_ASIO_CHECK(!multishot_receive3);
+  udp_sock.set_option(multishot_receive3, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::multishot_receive multishot_receive4;
+  udp_sock.get_option(multishot_receive4, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  BOOST_ASIO_CHECK(!multishot_receive4.value());
+  BOOST_ASIO_CHECK(!static_cast<bool>(multishot_receive4));
+  BOOST_ASIO_CHECK(!multishot_receive4);
+
+  // zero_copy_send class.
+
+  socket_base::zero_copy_send zero_copy_send1(true);
+  BOOST_ASIO_CHECK(zero_copy_send1.value());
+  BOOST_ASIO_CHECK(static_cast<bool>(zero_copy_send1));
+  BOOST_ASIO_CHECK(!!zero_copy_send1);
+  tcp_sock.set_option(zero_copy_send1, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::zero_copy_send zero_copy_send2;
+  tcp_sock.get_option(zero_copy_send2, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  BOOST_ASIO_CHECK(zero_copy_send2.value());
+  BOOST_ASIO_CHECK(static_cast<bool>(zero_copy_send2));
+  BOOST_ASIO_CHECK(!!zero_copy_send2);
+
+  socket_base::zero_copy_send zero_copy_send3(false);
+  BOOST_ASIO_CHECK(!zero_copy_send3.value());
+  BOOST_ASIO_CHECK(!static_cast<bool>(zero_copy_send3));
+  BOOST_ASIO_CHECK(!zero_copy_send3);
+  tcp_sock.set_option(zero_copy_send3, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::zero_copy_send zero_copy_send4;
+  tcp_sock.get_option(zero_copy_send4, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  BOOST_ASIO_CHECK(!zero_copy_send4.value());
+  BOOST_ASIO_CHECK(!static_cast<bool>(zero_copy_send4));
+  BOOST_ASIO_CHECK(!zero_copy_send4);
+
+  // inline_completion class.
+
+  socket_base::inline_completion inline_completion1(true);
+  BOOST_ASIO_CHECK(inline_completion1.value());
+  BOOST_ASIO_CHECK(static_cast<bool>(inline_completion1));
+  BOOST_ASIO_CHECK(!!inline_completion1);
+  tcp_sock.set_option(inline_completion1, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::inline_completion inline_completion2;
+  tcp_sock.get_option(inline_completion2, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  BOOST_ASIO_CHECK(inline_completion2.value());
+  BOOST_ASIO_CHECK(static_cast<bool>(inline_completion2));
+  BOOST_ASIO_CHECK(!!inline_completion2);
+
+  socket_base::inline_completion inline_completion3(false);
+  BOOST_ASIO_CHECK(!inline_completion3.value());
+  BOOST_ASIO_CHECK(!static_cast<bool>(inline_completion3));
+  BOOST_ASIO_CHECK(!inline_completion3);
+  tcp_sock.set_option(inline_completion3, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::inline_completion inline_completion4;
+  tcp_sock.get_option(inline_completion4, ec);
+  BOOST_ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  BOOST_ASIO_CHECK(!inline_completion4.value());
+  BOOST_ASIO_CHECK(!static_cast<bool>(inline_completion4));
+  BOOST_ASIO_CHECK(!inline_completion4);
+
   // bytes_readable class.
 
   socket_base::bytes_readable bytes_readable;
@@ -18,9 +18,11 @@
 
 #include <functional>
 #include <sstream>
+#include <boost/asio/config.hpp>
 #include <boost/asio/executor.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/dispatch.hpp>
+#include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/post.hpp>
 #include <boost/asio/detail/thread.hpp>
 #include <boost/asio/steady_timer.hpp>
@@ -430,6 +432,101 @@ void strand_execute_test()
   BOOST_ASIO_CHECK(count == 1);
 }
 
+struct sequence_check
+{
+  bool running;
+  int last[4];
+  int count;
+  int errors;
+};
+
+void check_sequence(sequence_check* c, int producer, int n)
+{
+  // Handlers must not run concurrently, and handlers posted by the same
+  // thread must run in the order in which they were posted.
+  if (c->running)
+    ++c->errors;
+  c->running = true;
+  if (c->last[producer] >= n)
+    ++c->errors;
+  c->last[producer] = n;
+  ++c->count;
+  c->running = false;
+}
+
+void post_sequence(strand<io_context::executor_type>* s,
+    sequence_check* c, int producer)
+{
+  for (int n = 0; n < 1000; ++n)
+    boost::asio::post(*s, bindns::bind(check_sequence, c, producer, n));
+}
+
+void strand_concurrent_post_test()
+{
+  io_context ioc;
+  strand<io_context::executor_type> s = make_strand(ioc);
+  executor_work_guard<io_context::executor_type> work = make_work_guard(ioc);
+  sequence_check c = { false, { -1, -1, -1, -1 }, 0, 0 };
+
+  boost::asio::detail::thread runner1(bindns::bind(io_context_run, &ioc));
+  boost::asio::detail::thread runner2(bindns::bind(io_context_run, &ioc));
+
+  boost::asio::detail::thread producer0(bindns::bind(post_sequence, &s, &c, 0));
+  boost::asio::detail::thread producer1(bindns::bind(post_sequence, &s, &c, 1));
+  boost::asio::detail::thread producer2(bindns::bind(post_sequence, &s, &c, 2));
+  post_sequence(&s, &c, 3);
+
+  // The statistics may be read while other threads are running the strand.
+  strand_statistics stats = s.statistics();
+  BOOST_ASIO_CHECK(stats.handlers <= 4000);
+
+  producer0.join();
+  producer1.join();
+  producer2.join();
+  work.reset();
+  runner1.join();
+  runner2.join();
+
+  BOOST_ASIO_CHECK(c.count == 4000);
+  BOOST_ASIO_CHECK(c.errors == 0);
+
+  stats = s.statistics();
+  BOOST_ASIO_CHECK(stats.handlers == 4000);
+}
+
+void record_count(int* count, int* recorded)
+{
+  *recorded = *count;
+}
+
+void strand_budget_test()
+{
+  io_context ioc(boost::asio::config_from_string("strand.handler_budget=2"));
+  strand<io_context::executor_type> s = make_strand(ioc);
+  sequence_check c = { false, { -1, -1, -1, -1 }, 0, 0 };
+  int recorded = -1;
+
+  for (int n = 0; n < 5; ++n)
+    boost::asio::post(s, bindns::bind(check_sequence, &c, 0, n));
+  boost::asio::post(ioc, bindns::bind(record_count, &c.count, &recorded));
+
+  ioc.run();
+
+  BOOST_ASIO_CHECK(c.count == 5);
+  BOOST_ASIO_CHECK(c.errors == 0);
+
+  // The first turn runs only the first function, as the others are waiting
+  // until the strand is next scheduled. The remaining four are then run two
+  // per turn, with the strand yielding once between them.
+  BOOST_ASIO_CHECK(recorded == 1);
+  strand_statistics stats = s.statistics();
+  BOOST_ASIO_CHECK(stats.turns == 3);
+  BOOST_ASIO_CHECK(stats.handlers == 5);
+  BOOST_ASIO_CHECK(stats.max_handlers_per_turn == 2);
+  BOOST_ASIO_CHECK(stats.max_queue_depth == 4);
+  BOOST_ASIO_CHECK(stats.yields == 1);
+}
+
 BOOST_ASIO_TEST_SUITE
 (
   "strand",
@@ -437,4 +534,6 @@ BOOST_ASIO_TEST_SUITE
   BOOST_ASIO_COMPILE_TEST_CASE(strand_conversion_test)
   BOOST_ASIO_TEST_CASE(strand_query_test)
   BOOST_ASIO_TEST_CASE(strand_execute_test)
+  BOOST_ASIO_TEST_CASE(strand_concurrent_post_test)
+  BOOST_ASIO_TEST_CASE(strand_budget_test)
 )
@@ -22,11 +22,15 @@
 #include <boost/asio/system_timer.hpp>
 
 #include <functional>
+#include <vector>
 #include <boost/asio/bind_cancellation_slot.hpp>
 #include <boost/asio/cancellation_signal.hpp>
+#include <boost/asio/config.hpp>
 #include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/detail/chrono_time_traits.hpp>
 #include <boost/asio/detail/thread.hpp>
+#include <boost/asio/detail/timer_queue.hpp>
 #include "unit_test.hpp"
 
 namespace bindns = std;
@@ -488,6 +492,331 @@ void system_timer_op_cancel_test()
   BOOST_ASIO_CHECK(ioc.stopped());
 }
 
+void record_expiry(std::vector<int>* order, int id,
+    const boost::system::error_code& ec)
+{
+  if (!ec)
+    order->push_back(id);
+}
+
+void system_timer_wheel_test()
+{
+  using boost::asio::chrono::milliseconds;
+  using bindns::placeholders::_1;
+
+  // With a 10 microsecond tick, the timers below are spread over the first
+  // three levels of the wheel.
+  boost::asio::io_context ioc(
+      boost::asio::config_from_string("timer.wheel_tick_usec=10"));
+  std::vector<int> order;
+
+  const boost::asio::system_timer::time_point start = now();
+  boost::asio::system_timer t1(ioc, milliseconds(150));
+  boost::asio::system_timer t2(ioc, milliseconds(1));
+  boost::asio::system_timer t3(ioc, milliseconds(30));
+  boost::asio::system_timer t4(ioc, milliseconds(60));
+  boost::asio::system_timer t5(ioc, milliseconds(100));
+  boost::asio::system_timer t6(ioc, milliseconds(10));
+
+  t1.async_wait(bindns::bind(record_expiry, &order, 1, _1));
+  t2.async_wait(bindns::bind(record_expiry, &order, 2, _1));
+  t3.async_wait(bindns::bind(record_expiry, &order, 3, _1));
+  t4.async_wait(bindns::bind(record_expiry, &order, 4, _1));
+  t5.async_wait(bindns::bind(record_expiry, &order, 5, _1));
+  t6.async_wait(bindns::bind(record_expiry, &order, 6, _1));
+
+  // Cancel one timer, and reschedule another to be the earliest.
+  BOOST_ASIO_CHECK(t4.cancel() == 1);
+  t5.expires_after(milliseconds(5));
+  t5.async_wait(bindns::bind(record_expiry, &order, 5, _1));
+
+  ioc.run();
+
+  BOOST_ASIO_CHECK(order.size() == 5);
+  BOOST_ASIO_CHECK(order.size() > 0 && order[0] == 2);
+  BOOST_ASIO_CHECK(order.size() > 1 && order[1] == 5);
+  BOOST_ASIO_CHECK(order.size() > 2 && order[2] == 6);
+  BOOST_ASIO_CHECK(order.size() > 3 && order[3] == 3);
+  BOOST_ASIO_CHECK(order.size() > 4 && order[4] == 1);
+
+  // No timer expires early.
+  BOOST_ASIO_CHECK(now() - start >= milliseconds(150));
+
+  // Timers that have already expired complete immediately.
+  t1.expires_at(start);
+  t1.async_wait(bindns::bind(record_expiry, &order, 1, _1));
+  ioc.restart();
+  ioc.run();
+
+  BOOST_ASIO_CHECK(order.size() == 6);
+}
+
+struct wheel_test_op : boost::asio::detail::wait_op
+{
+  wheel_test_op()
+    : boost::asio::detail::wait_op(&wheel_test_op::do_complete)
+  {
+  }
+
+  static void do_complete(void*, boost::asio::detail::operation*,
+      const boost::system::error_code&, std::size_t)
+  {
+  }
+};
+
+void system_timer_wheel_wait_test()
+{
+  typedef boost::asio::detail::chrono_time_traits<
+      boost::asio::chrono::system_clock,
+      boost::asio::wait_traits<boost::asio::chrono::system_clock>>
+    traits_type;
+  typedef boost::asio::detail::timer_queue<
+      traits_type, std::allocator<void>> queue_type;
+
+  // With a 10 microsecond tick, a timer that expires after one second is in
+  // the slot at the third level that starts at tick 98304.
+  queue_type queue(std::allocator<void>(), 0, 10);
+  queue_type::per_timer_data timer;
+  wheel_test_op op;
+  queue.enqueue_timer(now() + boost::asio::chrono::seconds(1), timer, &op);
+
+  // The reactor need not wake until the timers in that slot are moved.
+  long usec = queue.wait_duration_usec(10000000);
+  BOOST_ASIO_CHECK(usec > 900000);
+  BOOST_ASIO_CHECK(usec <= 983040);
+
+  boost::asio::detail::op_queue<boost::asio::detail::operation> ops;
+  BOOST_ASIO_CHECK(queue.cancel_timer(timer, ops) == 1);
+  while (ops.front())
+    ops.pop();
+}
+
+void system_timer_slack_test()
+{
+  using boost::asio::chrono::milliseconds;
+  using bindns::placeholders::_1;
+
+  boost::asio::io_context ioc;
+  std::vector<int> order;
+  int count = 0;
+
+  boost::asio::system_timer t1(ioc);
+  BOOST_ASIO_CHECK(t1.slack() == boost::asio::system_timer::duration());
+  t1.slack(milliseconds(20));
+  BOOST_ASIO_CHECK(t1.slack() == milliseconds(20));
+
+  // Rearming the timer with later expiry times cancels the earlier waits.
+  const boost::asio::system_timer::time_point start = now();
+  for (int i = 0; i < 50; ++i)
+  {
+    t1.expires_after(milliseconds(10 + i));
+    t1.async_wait(bindns::bind(increment_if_not_cancelled, &count, _1));
+  }
+
+  // A timer with slack that is destroyed while it is left in the queue.
+  {
+    boost::asio::system_timer t2(ioc, milliseconds(1));
+    t2.slack(milliseconds(5));
+    t2.async_wait(bindns::bind(increment_if_not_cancelled, &count, _1));
+    t2.cancel();
+  }
+
+  // A timer with slack that is moved while it is left in the queue.
+  boost::asio::system_timer t3(ioc, milliseconds(1));
+  t3.slack(milliseconds(5));
+  t3.async_wait(bindns::bind(record_expiry, &order, 3, _1));
+  t3.cancel();
+  boost::asio::system_timer t4(std::move(t3));
+  t4.expires_after(milliseconds(30));
+  t4.async_wait(bindns::bind(record_expiry, &order, 4, _1));
+  BOOST_ASIO_CHECK(t4.slack() == milliseconds(5));
+
+  // A moved-from timer has no slack, and so its cancelled waits are removed.
+  BOOST_ASIO_CHECK(t3.slack() == boost::asio::system_timer::duration());
+  t3.expires_after(milliseconds(1));
+  t3.async_wait(bindns::bind(increment_if_not_cancelled, &count, _1));
+  BOOST_ASIO_CHECK(t3.cancel() == 1);
+
+  boost::asio::system_timer t6(ioc);
+  t6.slack(milliseconds(5));
+  t3 = std::move(t6);
+  BOOST_ASIO_CHECK(t3.slack() == milliseconds(5));
+  BOOST_ASIO_CHECK(t6.slack() == boost::asio::system_timer::duration());
+  t6.expires_after(milliseconds(1));
+  t6.async_wait(bindns::bind(increment_if_not_cancelled, &count, _1));
+  BOOST_ASIO_CHECK(t6.cancel() == 1);
+
+  // Removing the slack removes a cancelled timer from the queue.
+  boost::asio::system_timer t5(ioc, milliseconds(1));
+  t5.slack(milliseconds(5));
+  t5.async_wait(bindns::bind(record_expiry, &order, 5, _1));
+  t5.cancel();
+  t5.slack(boost::asio::system_timer::duration());
+  t5.expires_after(milliseconds(20));
+  t5.async_wait(bindns::bind(record_expiry, &order, 5, _1));
+
+  ioc.run();
+
+  BOOST_ASIO_CHECK(count == 1);
+  BOOST_ASIO_CHECK(order.size() == 2);
+  BOOST_ASIO_CHECK(order.size() > 0 && order[0] == 5);
+  BOOST_ASIO_CHECK(order.size() > 1 && order[1] == 4);
+
+  // No timer expires early.
+  BOOST_ASIO_CHECK(now() - start >= milliseconds(59));
+}
+
+void count_periodic(boost::asio::system_timer* t, int limit,
+    int* count, int* aborted, const boost::system::error_code& ec)
+{
+  if (ec == boost::asio::error::operation_aborted)
+    ++(*aborted);
+  else if (!ec && ++(*count) == limit && t)
+    t->cancel();
+}
+
+void throw_periodic(int* count, int* aborted,
+    const boost::system::error_code& ec)
+{
+  if (ec == boost::asio::error::operation_aborted)
+    ++(*aborted);
+  else if (!ec && ++(*count) == 1)
+    throw 42;
+}
+
+void cancel_and_throw(boost::asio::system_timer* t, int* count,
+    int* aborted, const boost::system::error_code& ec)
+{
+  if (ec == boost::asio::error::operation_aborted)
+    ++(*aborted);
+  else if (!ec)
+  {
+    ++(*count);
+    t->cancel();
+    throw 42;
+  }
+}
+
+void system_timer_periodic_test()
+{
+  using boost::asio::chrono::hours;
+  using boost::asio::chrono::milliseconds;
+  using bindns::placeholders::_1;
+
+  boost::asio::io_context ioc;
+  int counts[6] = { 0, 0, 0, 0, 0, 0 };
+  int aborted[6] = { 0, 0, 0, 0, 0, 0 };
+
+  // A periodic wait completes until it is cancelled.
+  const boost::asio::system_timer::time_point start = now();
+  boost::asio::system_timer t1(ioc, milliseconds(5));
+  t1.async_wait_periodic(milliseconds(5),
+      bindns::bind(count_periodic, &t1, 5, &counts[0], &aborted[0], _1));
+
+  // Rescheduling a timer does not cancel its pending waits.
+  boost::asio::system_timer t2(ioc, hours(1));
+  t2.async_wait(bindns::bind(count_periodic,
+        static_cast<boost::asio::system_timer*>(0),
+        1, &counts[1], &aborted[1], _1));
+  t2.async_wait_periodic(hours(1),
+      bindns::bind(count_periodic, &t2, 1, &counts[2], &aborted[2], _1));
+  t2.reschedule_after(milliseconds(10));
+
+  // A periodic wait is cancelled when the timer is destroyed.
+  {
+    boost::asio::system_timer t3(ioc, milliseconds(1));
+    t3.async_wait_periodic(milliseconds(1),
+        bindns::bind(count_periodic, &t3, 100, &counts[3], &aborted[3], _1));
+  }
+
+  // A periodic wait moves with the timer.
+  boost::asio::system_timer t4(ioc, milliseconds(1));
+  t4.async_wait_periodic(milliseconds(2),
+      bindns::bind(count_periodic, &t4, 0, &counts[4], &aborted[4], _1));
+  boost::asio::system_timer t5(std::move(t4));
+  t5.async_wait_periodic(milliseconds(2),
+      bindns::bind(count_periodic, &t5, 3, &counts[5], &aborted[5], _1));
+
+  ioc.run();
+
+  BOOST_ASIO_CHECK(counts[0] == 5);
+  BOOST_ASIO_CHECK(aborted[0] == 1);
+  BOOST_ASIO_CHECK(now() - start >= milliseconds(25));
+  BOOST_ASIO_CHECK(counts[1] == 1);
+  BOOST_ASIO_CHECK(aborted[1] == 0);
+  BOOST_ASIO_CHECK(counts[2] == 1);
+  BOOST_ASIO_CHECK(aborted[2] == 1);
+  BOOST_ASIO_CHECK(counts[3] == 0);
+  BOOST_ASIO_CHECK(aborted[3] == 1);
+  BOOST_ASIO_CHECK(counts[4] == 0);
+  BOOST_ASIO_CHECK(aborted[4] == 1);
+  BOOST_ASIO_CHECK(counts[5] == 3);
+  BOOST_ASIO_CHECK(aborted[5] == 1);
+
+  // A periodic wait continues after its handler throws, and completes with
+  // operation_aborted when it is cancelled.
+  boost::asio::system_timer t6(ioc, milliseconds(1));
+  t6.async_wait_periodic(hours(1),
+      bindns::bind(throw_periodic, &counts[0], &aborted[0], _1));
+  counts[0] = 0;
+  aborted[0] = 0;
+
+  bool thrown = false;
+  ioc.restart();
+  try
+  {
+    ioc.run();
+  }
+  catch (int)
+  {
+    thrown = true;
+  }
+  BOOST_ASIO_CHECK(thrown);
+  BOOST_ASIO_CHECK(counts[0] == 1);
+  BOOST_ASIO_CHECK(aborted[0] == 0);
+
+  BOOST_ASIO_CHECK(t6.cancel() == 1);
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(counts[0] == 1);
+  BOOST_ASIO_CHECK(aborted[0] == 1);
+
+  // A periodic wait cancelled by its handler, which then throws, completes
+  // with operation_aborted.
+  t6.expires_after(milliseconds(1));
+  t6.async_wait_periodic(milliseconds(1),
+      bindns::bind(cancel_and_throw, &t6, &counts[0], &aborted[0], _1));
+
+  thrown = false;
+  ioc.restart();
+  try
+  {
+    ioc.run();
+  }
+  catch (int)
+  {
+    thrown = true;
+  }
+  BOOST_ASIO_CHECK(thrown);
+
+  ioc.restart();
+  ioc.run();
+  BOOST_ASIO_CHECK(counts[0] == 2);
+  BOOST_ASIO_CHECK(aborted[0] == 2);
+
+  bool invalid_interval = false;
+  try
+  {
+    t1.async_wait_periodic(milliseconds(0),
+        bindns::bind(count_periodic, &t1, 1, &counts[0], &aborted[0], _1));
+  }
+  catch (boost::system::system_error&)
+  {
+    invalid_interval = true;
+  }
+  BOOST_ASIO_CHECK(invalid_interval);
+}
+
 BOOST_ASIO_TEST_SUITE
 (
   "system_timer",
@@ -497,4 +826,8 @@ BOOST_ASIO_TEST_SUITE
   BOOST_ASIO_TEST_CASE(system_timer_thread_test)
   BOOST_ASIO_TEST_CASE(system_timer_move_test)
   BOOST_ASIO_TEST_CASE(system_timer_op_cancel_test)
+  BOOST_ASIO_TEST_CASE(system_timer_wheel_test)
+  BOOST_ASIO_TEST_CASE(system_timer_wheel_wait_test)
+  BOOST_ASIO_TEST_CASE(system_timer_slack_test)
+  BOOST_ASIO_TEST_CASE(system_timer_periodic_test)
 )
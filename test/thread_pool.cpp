@@ -16,9 +16,17 @@
 // Test that header file is self-contained.
 #include <boost/asio/thread_pool.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <thread>
+#include <vector>
+#include <boost/asio/config.hpp>
 #include <boost/asio/dispatch.hpp>
+#include <boost/asio/io_context.hpp>
 #include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/detail/thread_affinity.hpp>
 #include "unit_test.hpp"
 
 using namespace boost::asio;
@@ -77,6 +85,261 @@ void thread_pool_test()
   BOOST_ASIO_CHECK(count3 == 0);
 }
 
+void fan_out(thread_pool* pool, int depth, std::atomic<int>* count)
+{
+  ++(*count);
+  if (depth > 0)
+  {
+    boost::asio::post(*pool, bindns::bind(fan_out, pool, depth - 1, count));
+    boost::asio::post(*pool, bindns::bind(fan_out, pool, depth - 1, count));
+  }
+}
+
+void handle_timer(const boost::system::error_code& ec,
+    thread_pool* pool, std::atomic<int>* count)
+{
+  BOOST_ASIO_CHECK(!ec);
+  boost::asio::post(*pool, bindns::bind(fan_out, pool, 4, count));
+}
+
+void thread_pool_work_stealing_test()
+{
+  thread_pool pool(4,
+      config_from_string("scheduler.work_stealing_queues=4"));
+
+  // Handlers posted from within the pool are added to the posting thread's
+  // queue and stolen by the other threads.
+  std::atomic<int> count1(0);
+  boost::asio::post(pool, bindns::bind(fan_out, &pool, 12, &count1));
+
+  // Handlers are also run when they are produced by the reactor.
+  std::atomic<int> count2(0);
+  boost::asio::steady_timer timer(pool, boost::asio::chrono::milliseconds(10));
+  timer.async_wait(
+      bindns::bind(handle_timer, bindns::placeholders::_1, &pool, &count2));
+
+  pool.wait();
+
+  BOOST_ASIO_CHECK(count1 == (1 << 13) - 1);
+  BOOST_ASIO_CHECK(count2 == (1 << 5) - 1);
+}
+
+void ignore_timer(const boost::system::error_code&)
+{
+}
+
+void set_flag(std::atomic<bool>* flag)
+{
+  *flag = true;
+}
+
+void post_and_wait(thread_pool* pool, std::atomic<bool>* flag)
+{
+  // Give the other thread time to block in the reactor.
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // The handler is added to this thread's queue, and so must be stolen by
+  // the other thread while this one is blocked.
+  boost::asio::post(*pool, bindns::bind(set_flag, flag));
+  for (int i = 0; i < 5000 && !*flag; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+void thread_pool_work_stealing_wakeup_test()
+{
+  thread_pool pool(2,
+      config_from_string("scheduler.work_stealing_queues=2"));
+
+  // A pending timer keeps the reactor blocked without a timeout.
+  boost::asio::steady_timer timer(pool, boost::asio::chrono::hours(1));
+  timer.async_wait(ignore_timer);
+
+  std::atomic<bool> flag(false);
+  boost::asio::post(pool, bindns::bind(post_and_wait, &pool, &flag));
+
+  for (int i = 0; i < 5000 && !flag; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  BOOST_ASIO_CHECK(flag);
+
+  timer.cancel();
+  pool.wait();
+}
+
+void repost_until_set(thread_pool* pool,
+    std::atomic<bool>* flag, int* remaining)
+{
+  if (!*flag && *remaining > 0)
+  {
+    --*remaining;
+    boost::asio::post(*pool,
+        bindns::bind(repost_until_set, pool, flag, remaining));
+  }
+}
+
+void set_flag_on_timer(const boost::system::error_code&,
+    std::atomic<bool>* flag)
+{
+  *flag = true;
+}
+
+void thread_pool_work_stealing_fairness_test()
+{
+  thread_pool pool(1,
+      config_from_string("scheduler.work_stealing_queues=1"));
+
+  // A handler that keeps reposting itself to the thread's own queue must not
+  // prevent the timer from completing.
+  std::atomic<bool> flag(false);
+  boost::asio::steady_timer timer(pool, boost::asio::chrono::milliseconds(10));
+  timer.async_wait(
+      bindns::bind(set_flag_on_timer, bindns::placeholders::_1, &flag));
+
+  int remaining = 10000000;
+  boost::asio::post(pool,
+      bindns::bind(repost_until_set, &pool, &flag, &remaining));
+
+  pool.wait();
+
+  BOOST_ASIO_CHECK(flag);
+  BOOST_ASIO_CHECK(remaining > 0);
+}
+
+void thread_pool_work_count_batch_test()
+{
+  thread_pool pool(4,
+      config_from_string("scheduler.work_count_batch=64"));
+
+  // The pool's threads exit once all handlers have run, even though each
+  // thread counts the handlers it has finished in batches.
+  std::atomic<int> count1(0);
+  boost::asio::post(pool, bindns::bind(fan_out, &pool, 12, &count1));
+
+  std::atomic<int> count2(0);
+  boost::asio::steady_timer timer(pool, boost::asio::chrono::milliseconds(10));
+  timer.async_wait(
+      bindns::bind(handle_timer, bindns::placeholders::_1, &pool, &count2));
+
+  pool.wait();
+
+  BOOST_ASIO_CHECK(count1 == (1 << 13) - 1);
+  BOOST_ASIO_CHECK(count2 == (1 << 5) - 1);
+
+  // Combined with work stealing.
+  thread_pool pool2(4,
+      config_from_string(
+        "scheduler.work_count_batch=64\n"
+        "scheduler.work_stealing_queues=4"));
+
+  std::atomic<int> count3(0);
+  boost::asio::post(pool2, bindns::bind(fan_out, &pool2, 12, &count3));
+  pool2.wait();
+
+  BOOST_ASIO_CHECK(count3 == (1 << 13) - 1);
+}
+
+void ping_pong(thread_pool* pool, int remaining, std::atomic<int>* count)
+{
+  ++(*count);
+  if (remaining > 0)
+  {
+    boost::asio::post(*pool,
+        bindns::bind(ping_pong, pool, remaining - 1, count));
+  }
+}
+
+void thread_pool_handler_arena_test()
+{
+  std::atomic<int> count1(0);
+  std::atomic<int> count2(0);
+  boost::asio::io_context ioc;
+
+  {
+    thread_pool pool(4,
+        config_from_string("scheduler.handler_arena=1"));
+
+    // Handlers allocated by one thread of the pool are freed by others.
+    for (int i = 0; i < 16; ++i)
+      boost::asio::post(pool, bindns::bind(ping_pong, &pool, 1000, &count1));
+
+    // Handlers allocated by the pool's threads, and freed after the threads
+    // have exited.
+    for (int i = 0; i < 16; ++i)
+      boost::asio::post(pool, bindns::bind(ping_pong, &pool, 0, &count2));
+    boost::asio::post(pool,
+        [&ioc, &count2]
+        {
+          for (int i = 0; i < 16; ++i)
+            boost::asio::post(ioc, [&count2]{ ++count2; });
+        });
+
+    pool.wait();
+  }
+
+  BOOST_ASIO_CHECK(count1 == 16 * 1001);
+  BOOST_ASIO_CHECK(count2 == 16);
+
+  ioc.run();
+
+  BOOST_ASIO_CHECK(count2 == 32);
+}
+
+void record_cpus(std::vector<std::size_t>* cpus)
+{
+  boost::asio::detail::get_available_cpus(*cpus);
+}
+
+void thread_pool_placement_test()
+{
+  std::vector<std::size_t> available;
+  boost::asio::detail::get_available_cpus(available);
+  BOOST_ASIO_CHECK(!available.empty());
+
+  std::vector<std::vector<std::size_t>> nodes;
+  boost::asio::detail::get_numa_node_cpus(nodes);
+  BOOST_ASIO_CHECK(!nodes.empty());
+
+  std::size_t num_node_cpus = 0;
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+    num_node_cpus += nodes[i].size();
+  BOOST_ASIO_CHECK(num_node_cpus == available.size());
+
+  std::vector<std::size_t> pinned_cpus;
+  std::vector<std::size_t> node_cpus;
+
+  {
+    thread_pool pool(1,
+        config_from_string("thread_pool.pin_threads=1"));
+    boost::asio::post(pool, bindns::bind(record_cpus, &pinned_cpus));
+    pool.wait();
+  }
+
+  {
+    thread_pool pool(1,
+        config_from_string("thread_pool.numa_nodes=1"));
+    boost::asio::post(pool, bindns::bind(record_cpus, &node_cpus));
+    pool.wait();
+  }
+
+#if defined(__linux__)
+  // The first thread is bound to the first available CPU, or to the CPUs of
+  // the first node.
+  BOOST_ASIO_CHECK(pinned_cpus.size() == 1);
+  BOOST_ASIO_CHECK(pinned_cpus.size() == 1 && pinned_cpus[0] == available[0]);
+  BOOST_ASIO_CHECK(node_cpus == nodes[0]);
+#endif // defined(__linux__)
+
+  // Handlers run when the threads are divided between the nodes.
+  std::atomic<int> count(0);
+  thread_pool pool(4,
+      config_from_string(
+        "thread_pool.pin_threads=1\n"
+        "thread_pool.numa_nodes=1"));
+  boost::asio::post(pool, bindns::bind(fan_out, &pool, 8, &count));
+  pool.wait();
+
+  BOOST_ASIO_CHECK(count == (1 << 9) - 1);
+}
+
 class test_service : public boost::asio::execution_context::service
 {
 public:
@@ -426,6 +689,12 @@ BOOST_ASIO_TEST_SUITE
 (
   "thread_pool",
   BOOST_ASIO_TEST_CASE(thread_pool_test)
+  BOOST_ASIO_TEST_CASE(thread_pool_work_stealing_test)
+  BOOST_ASIO_TEST_CASE(thread_pool_work_stealing_wakeup_test)
+  BOOST_ASIO_TEST_CASE(thread_pool_work_stealing_fairness_test)
+  BOOST_ASIO_TEST_CASE(thread_pool_work_count_batch_test)
+  BOOST_ASIO_TEST_CASE(thread_pool_handler_arena_test)
+  BOOST_ASIO_TEST_CASE(thread_pool_placement_test)
   BOOST_ASIO_TEST_CASE(thread_pool_service_test)
   BOOST_ASIO_TEST_CASE(thread_pool_executor_query_test)
   BOOST_ASIO_TEST_CASE(thread_pool_executor_execute_test)